@@ -10,23 +10,24 @@
 #include <string.h>
 #include <stdlib.h>
 
+#include "argz_reserve.h"
+
 error_t
 argz_add (char **argz,
        size_t *argz_len,
        const char *str)
 {
-  int len_to_add = 0;
-  size_t last = *argz_len;
+  size_t len_to_add = 0;
 
   if (str == NULL)
     return 0;
 
   len_to_add = strlen(str) + 1;
-  *argz_len += len_to_add;
 
-  if(!(*argz = (char *)realloc(*argz, *argz_len)))
+  if (_argz_reserve(argz, *argz_len, *argz_len + len_to_add))
     return ENOMEM;
 
-  memcpy(*argz + last, str, len_to_add);
+  memcpy(*argz + *argz_len, str, len_to_add);
+  *argz_len += len_to_add;
   return 0;
 }
@@ -10,6 +10,8 @@
 #include <string.h>
 #include <stdlib.h>
 
+#include "argz_reserve.h"
+
 error_t
 argz_append (char **argz,
        size_t *argz_len,
@@ -18,14 +20,11 @@ argz_append (char **argz,
 {
   if (buf_len)
     {
-      size_t last = *argz_len;
-
-      *argz_len += buf_len;
-
-      if(!(*argz = (char *)realloc(*argz, *argz_len)))
+      if (_argz_reserve(argz, *argz_len, *argz_len + buf_len))
 	return ENOMEM;
 
-      memcpy(*argz + last, buf, buf_len);
+      memcpy(*argz + *argz_len, buf, buf_len);
+      *argz_len += buf_len;
     }
   return 0;
 }
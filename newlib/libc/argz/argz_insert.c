@@ -12,6 +12,8 @@
 #define __need_ptrdiff_t
 #include <stddef.h>
 
+#include "argz_reserve.h"
+
 error_t
 argz_insert (char **argz,
        size_t *argz_len,
@@ -35,7 +37,7 @@ argz_insert (char **argz,
 
   len = strlen(entry) + 1;
 
-  if(!(*argz = (char *)realloc(*argz, *argz_len + len)))
+  if (_argz_reserve(argz, *argz_len, *argz_len + len))
     return ENOMEM;
   
   memmove(*argz + delta + len, *argz + delta,  *argz_len - delta);
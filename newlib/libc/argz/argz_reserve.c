@@ -0,0 +1,30 @@
+/* Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include <errno.h>
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <malloc.h>
+
+#include "argz_reserve.h"
+
+error_t
+_argz_reserve (char **argz,
+       size_t len,
+       size_t need)
+{
+  char *p;
+
+#ifdef _ARGZ_GROW
+  if (*argz != NULL && malloc_usable_size (*argz) >= need)
+    return 0;
+  if (len <= SIZE_MAX / 2 && need < 2 * len)
+    need = 2 * len;
+#endif
+  if (!(p = (char *)realloc(*argz, need)))
+    return ENOMEM;
+  *argz = p;
+  return 0;
+}
@@ -0,0 +1,19 @@
+/* Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Private helper for the argz and envz functions that add to a vector.  */
+
+#include <sys/types.h>
+#include <argz.h>
+
+#if !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__) \
+    && !defined (MALLOC_PROVIDED)
+/* Vectors grow geometrically, and malloc_usable_size tells how much room
+   is left in them, so that most additions do not need a realloc.  */
+#define _ARGZ_GROW
+#endif
+
+/* Make room for at least need bytes in *argz, of which the first len are
+   in use.  Return 0, or ENOMEM with *argz unchanged.  */
+error_t _argz_reserve (char **argz, size_t len, size_t need);
@@ -11,6 +11,8 @@
 #include <argz.h>
 #include <envz.h>
 
+#include "argz_reserve.h"
+
 error_t
 envz_add (char **envz,
        size_t *envz_len,
@@ -18,29 +20,28 @@ envz_add (char **envz,
        const char *value)
 {
   char *concat = NULL;
-  int name_len = 0;
-  int val_len = 0;
-  int retval = 0;
+  size_t name_len = 0;
+  size_t val_len = 0;
 
   envz_remove(envz, envz_len, name);
 
   if (value)
     {
+      /* Build "name=value" in place at the end of the vector. */
       name_len = strlen(name);
       val_len = strlen(value);
-      if(!(concat = (char *) malloc(name_len + val_len + 2)))
+      if (_argz_reserve(envz, *envz_len, *envz_len + name_len + val_len + 2))
         return ENOMEM;
 
+      concat = *envz + *envz_len;
       memcpy(concat, name, name_len);
       concat[name_len] = '=';
       memcpy(concat + name_len + 1, value, val_len + 1);
-
-      retval = argz_add(envz, envz_len, concat);
-      free(concat);
+      *envz_len += name_len + val_len + 2;
+      return 0;
     }
   else
     {
-      retval = argz_add(envz, envz_len, name);
+      return argz_add(envz, envz_len, name);
     }
-  return retval;
 }
@@ -10,36 +10,26 @@
 #include <stdlib.h>
 #include <envz.h>
 
-#include "buf_findstr.h"
-
+/* Return the entry whose name, the part before any '=', matches the name
+   part of name.  Entries are stepped over with memchr.  */
 char *
 envz_entry (const char *envz,
        size_t envz_len,
        const char *name)
 {
-  char *buf_ptr = (char *)envz;
-  size_t buf_len = envz_len;
+  const char *end = envz + envz_len;
+  const char *next;
+  size_t name_len = strcspn(name, "=");
 
-  while(buf_len)
+  while (envz < end)
     {
-      if (_buf_findstr(name, &buf_ptr, &buf_len))
-        {
-          if (buf_ptr)
-            {
-              if (*buf_ptr == '=' || *buf_ptr == '\0')
-                {
-                  buf_ptr--;
-
-                  /* Move buf_ptr back to start of entry. */
-                  while(*buf_ptr != '\0' && buf_ptr != envz) buf_ptr--;
-                  
-                  if(*buf_ptr == '\0')
-                    buf_ptr++;
-
-                  return (char *)buf_ptr;
-                }
-            }
-        }
+      next = (const char *)memchr(envz, '\0', end - envz);
+      next = next ? next + 1 : end;
+      if ((size_t)(next - envz) > name_len
+          && memcmp(envz, name, name_len) == 0
+          && (envz[name_len] == '=' || envz[name_len] == '\0'))
+        return (char *)envz;
+      envz = next;
     }
   return 0;
 }
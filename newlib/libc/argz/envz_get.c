@@ -10,33 +10,15 @@
 #include <stdlib.h>
 #include <envz.h>
 
-#include "buf_findstr.h"
-
 char *
 envz_get (const char *envz,
        size_t envz_len,
        const char *name)
 {
-  char *buf_ptr = (char *)envz;
-  size_t buf_len = envz_len;
+  char *entry = envz_entry(envz, envz_len, name);
 
-  while(buf_len)
-    {
-      if (_buf_findstr(name, &buf_ptr, &buf_len))
-        {
-          if (*buf_ptr == '=')
-            {
-              buf_ptr++;
-              return (char *)buf_ptr;
-            }
-          else
-            {
-              if (*buf_ptr == '\0')
-                /* NULL entry. */
-                return NULL;
-            }
-        }
-    }
-  /* No matching entries found. */
-  return NULL;
+  /* No matching entry, or a NULL entry without '='. */
+  if (entry == NULL || (entry = strchr(entry, '=')) == NULL)
+    return NULL;
+  return entry + 1;
 }
@@ -19,43 +19,17 @@ envz_merge (char **envz,
        int override)
 {
   char *entry = NULL;
-  char *name_str = NULL;
-  char *val_str = NULL;
-  char *name_iter = NULL;
   int retval = 0;
 
+  /* envz_entry and envz_remove only look at the name part of entry, so
+     the entries of envz2 are used as they are.  */
   while((entry = argz_next((char *)envz2, envz2_len, entry)) && !retval)
     {
-      if (!override)
-        {
-          name_str = strdup (entry);
-          name_iter = strchr(name_str, '=');
-          if(name_iter)
-            *name_iter = '\0';
-
-          if(!envz_entry(*envz, *envz_len, name_str))
-            {
-              retval = argz_add(envz, envz_len, entry);
-            }
-          free(name_str);
-        }
-      else
-        {
-          name_str = strdup (entry);
-          name_iter = strchr(name_str, '=');
-          if(name_iter)
-            {
-              *name_iter = '\0';
-              val_str = name_iter + 1;
-            }
-          else
-            {
-              val_str = NULL;
-            }
-
-          retval = envz_add(envz, envz_len, name_str, val_str);
-          free(name_str);
-        }
+      if (override)
+        envz_remove(envz, envz_len, entry);
+      else if (envz_entry(*envz, *envz_len, entry))
+        continue;
+      retval = argz_add(envz, envz_len, entry);
     }
   return retval;
 }
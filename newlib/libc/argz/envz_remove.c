@@ -11,6 +11,8 @@
 #include <argz.h>
 #include <envz.h>
 
+#include "argz_reserve.h"
+
 void
 envz_remove (char **envz,
        size_t *envz_len,
@@ -30,7 +32,9 @@ envz_remove (char **envz,
           memmove(entry, entry + len, *envz + *envz_len - entry - len);
         }
 
+#ifndef _ARGZ_GROW
       *envz = (char *)realloc(*envz, *envz_len - len);
+#endif
       *envz_len -= len;
     }
 }
@@ -0,0 +1,363 @@
+/* generated by mktrie, do not edit */
+/* 123 + 1024 + 1712 entries */
+#define CASECONV_TRIE_LIMIT 0x1EC00
+static const unsigned char caseconv_trie1[123] = {
+  0, 1, 2, 2, 3, 2, 2, 4, 5, 6, 2, 7, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 8, 9, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 10,
+  2, 11, 2, 12, 2, 2, 13, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 14, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 15,
+};
+static const unsigned char caseconv_trie2[1024] = {
+  0, 0, 0, 0, 1, 2, 3, 4, 0, 0, 0, 5, 6, 7, 8, 9,
+  10, 10, 10, 11, 12, 10, 10, 13, 14, 15, 16, 17, 18, 19, 10, 20,
+  10, 10, 21, 22, 23, 24, 25, 26, 27, 28, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 29, 0, 0, 30, 31, 1, 32, 3, 33, 34, 10, 35,
+  36, 6, 6, 8, 8, 37, 10, 10, 38, 10, 10, 10, 39, 10, 10, 10,
+  10, 10, 10, 40, 41, 42, 43, 44, 45, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 46, 47, 48, 48, 49,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 51,
+  0, 0, 0, 0, 0, 0, 0, 0, 52, 53, 53, 54, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 55, 0, 0, 0, 0, 0, 0, 0, 0,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 56, 10, 10, 10, 10, 10, 10,
+  57, 58, 57, 57, 58, 59, 57, 60, 57, 57, 57, 61, 62, 63, 64, 65,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 66, 67, 68, 0, 69, 70, 71, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 73, 74, 75, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  41, 41, 76, 44, 44, 77, 78, 79, 10, 10, 10, 10, 10, 10, 80, 81,
+  82, 82, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 10, 10, 84, 0, 10, 85, 0, 0, 0, 0, 0, 0,
+  0, 0, 86, 86, 10, 10, 10, 87, 88, 89, 90, 91, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 92, 0, 93, 93, 93, 93, 93, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  94, 94, 95, 96, 96, 0, 0, 0, 0, 0, 0, 94, 94, 97, 96, 98,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 99, 99, 99, 100, 101, 101, 101, 102,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 8, 8, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 6, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  103, 103, 104, 105, 106, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+static const unsigned char caseconv_trie3[1712] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+  0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 4,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  6, 7, 5, 5, 5, 5, 5, 5, 0, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 5, 5, 5, 5, 5, 5,
+  5, 5, 5, 5, 5, 5, 5, 5, 9, 8, 8, 8, 8, 8, 8, 10,
+  11, 12, 5, 5, 5, 5, 13, 8, 8, 14, 14, 8, 8, 0, 15, 16,
+  17, 8, 8, 14, 18, 19, 20, 21, 5, 5, 22, 0, 20, 23, 24, 25,
+  5, 5, 5, 5, 5, 5, 26, 8, 8, 26, 0, 0, 5, 5, 26, 8,
+  8, 27, 27, 8, 8, 8, 8, 28, 5, 5, 0, 0, 5, 5, 0, 29,
+  0, 0, 0, 0, 30, 31, 32, 30, 31, 32, 30, 31, 32, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 33, 5, 5,
+  0, 30, 31, 32, 5, 5, 34, 35, 5, 5, 5, 5, 5, 5, 5, 5,
+  36, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 37, 8, 8, 38, 39, 40,
+  40, 8, 8, 41, 42, 43, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  44, 45, 46, 47, 48, 0, 49, 49, 0, 50, 0, 51, 52, 0, 0, 0,
+  49, 53, 0, 54, 0, 55, 56, 0, 57, 58, 56, 59, 60, 0, 0, 58,
+  0, 61, 62, 0, 0, 63, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0,
+  65, 0, 0, 65, 0, 0, 0, 66, 65, 67, 68, 68, 69, 0, 0, 0,
+  0, 0, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 71, 72, 0,
+  0, 0, 0, 0, 0, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  5, 5, 5, 5, 0, 0, 5, 5, 0, 0, 0, 24, 24, 24, 0, 74,
+  0, 0, 0, 0, 0, 0, 75, 0, 76, 76, 76, 0, 77, 0, 78, 78,
+  1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 79, 80, 80, 80,
+  2, 2, 81, 2, 2, 2, 2, 2, 2, 2, 2, 2, 82, 83, 83, 84,
+  85, 86, 0, 0, 0, 87, 88, 89, 5, 5, 5, 5, 5, 5, 5, 5,
+  90, 91, 92, 93, 94, 95, 0, 8, 8, 96, 5, 5, 0, 36, 36, 36,
+  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+  5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 5, 5, 5,
+  98, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 99,
+  0, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+  101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+  101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 0, 102, 0, 0, 0, 0, 0, 102, 0, 0,
+  103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+  103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 0, 0, 103, 103, 103,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  84, 84, 84, 84, 84, 84, 0, 0, 89, 89, 89, 89, 89, 89, 0, 0,
+  105, 106, 107, 108, 108, 109, 110, 111, 112, 0, 0, 0, 0, 0, 0, 0,
+  113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+  113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 0, 0, 113, 113, 113,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 114, 0, 0, 0, 115, 0, 0,
+  5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 116, 0, 0, 117, 0,
+  118, 118, 118, 118, 118, 118, 118, 118, 119, 119, 119, 119, 119, 119, 119, 119,
+  118, 118, 118, 118, 118, 118, 0, 0, 119, 119, 119, 119, 119, 119, 0, 0,
+  0, 118, 0, 118, 0, 118, 0, 118, 0, 119, 0, 119, 0, 119, 0, 119,
+  120, 120, 121, 121, 121, 121, 122, 122, 123, 123, 124, 124, 125, 125, 0, 0,
+  118, 118, 0, 126, 0, 0, 0, 0, 119, 119, 127, 127, 128, 0, 129, 0,
+  0, 0, 0, 126, 0, 0, 0, 0, 130, 130, 130, 130, 128, 0, 0, 0,
+  118, 118, 0, 0, 0, 0, 0, 0, 119, 119, 131, 131, 0, 0, 0, 0,
+  118, 118, 0, 0, 0, 92, 0, 0, 119, 119, 132, 132, 96, 0, 0, 0,
+  0, 0, 0, 126, 0, 0, 0, 0, 133, 133, 134, 134, 128, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 135, 0, 0, 0, 136, 137, 0, 0, 0, 0,
+  0, 0, 138, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 139, 0,
+  140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  0, 0, 0, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+  142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+  143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+  143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 0, 0, 0, 0, 0, 0,
+  100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 0,
+  101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0,
+  5, 5, 144, 145, 146, 147, 148, 8, 8, 8, 8, 8, 8, 149, 150, 151,
+  152, 0, 5, 5, 0, 8, 8, 0, 0, 0, 0, 0, 0, 0, 153, 153,
+  5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 0,
+  0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+  154, 154, 154, 154, 154, 154, 0, 154, 0, 0, 0, 0, 0, 154, 0, 0,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0,
+  0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 155, 5, 5,
+  5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 8, 8, 156, 0, 0,
+  5, 5, 5, 5, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 157, 158, 159, 160, 157, 0,
+  161, 162, 163, 164, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 165, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+  167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+  167, 167, 167, 167, 167, 167, 167, 167, 168, 168, 168, 168, 168, 168, 168, 168,
+  168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168,
+  167, 167, 167, 167, 0, 0, 0, 0, 168, 168, 168, 168, 168, 168, 168, 168,
+  168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 0, 0, 0, 0,
+  77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+  82, 82, 82, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+  169, 169, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+#define caseconv_trie(c) \
+  caseconv_trie3[caseconv_trie2[caseconv_trie1[(c) >> 10] << 6 | ((c) >> 4 & 63)] << 4 \
+	     | ((c) & 15)]
+static const struct caseconv_entry caseconv_rules[] = {
+  {TOLO, 32},
+  {TOUP, -32},
+  {TOUP, 743},
+  {TOUP, 121},
+  {TO1, EVENCAP},
+  {TOLO, -199},
+  {TOUP, -232},
+  {TO1, ODDCAP},
+  {TOLO, -121},
+  {TOUP, -300},
+  {TOUP, 195},
+  {TOLO, 210},
+  {TOLO, 206},
+  {TOLO, 205},
+  {TOLO, 79},
+  {TOLO, 202},
+  {TOLO, 203},
+  {TOLO, 207},
+  {TOUP, 97},
+  {TOLO, 211},
+  {TOLO, 209},
+  {TOUP, 163},
+  {TOLO, 213},
+  {TOUP, 130},
+  {TOLO, 214},
+  {TOLO, 218},
+  {TOLO, 217},
+  {TOLO, 219},
+  {TOUP, 56},
+  {TOLO, 2},
+  {TOBOTH, 0},
+  {TOUP, -2},
+  {TOUP, -79},
+  {TOLO, -97},
+  {TOLO, -56},
+  {TOLO, -130},
+  {TOLO, 10795},
+  {TOLO, -163},
+  {TOLO, 10792},
+  {TOUP, 10815},
+  {TOLO, -195},
+  {TOLO, 69},
+  {TOLO, 71},
+  {TOUP, 10783},
+  {TOUP, 10780},
+  {TOUP, 10782},
+  {TOUP, -210},
+  {TOUP, -206},
+  {TOUP, -205},
+  {TOUP, -202},
+  {TOUP, -203},
+  {TOUP, 42319},
+  {TOUP, 42315},
+  {TOUP, -207},
+  {TOUP, 42280},
+  {TOUP, 42308},
+  {TOUP, -209},
+  {TOUP, -211},
+  {TOUP, 10743},
+  {TOUP, 42305},
+  {TOUP, 10749},
+  {TOUP, -213},
+  {TOUP, -214},
+  {TOUP, 10727},
+  {TOUP, -218},
+  {TOUP, 42282},
+  {TOUP, -69},
+  {TOUP, -217},
+  {TOUP, -71},
+  {TOUP, -219},
+  {TOUP, 42261},
+  {TOUP, 42258},
+  {TOUP, 84},
+  {TOLO, 116},
+  {TOLO, 38},
+  {TOLO, 37},
+  {TOLO, 64},
+  {TOLO, 63},
+  {TOUP, -38},
+  {TOUP, -37},
+  {TOUP, -31},
+  {TOUP, -64},
+  {TOUP, -63},
+  {TOLO, 8},
+  {TOUP, -62},
+  {TOUP, -57},
+  {TOUP, -47},
+  {TOUP, -54},
+  {TOUP, -8},
+  {TOUP, -86},
+  {TOUP, -80},
+  {TOUP, 7},
+  {TOUP, -116},
+  {TOLO, -60},
+  {TOUP, -96},
+  {TOLO, -7},
+  {TOLO, 80},
+  {TOLO, 15},
+  {TOUP, -15},
+  {TOLO, 48},
+  {TOUP, -48},
+  {TOLO, 7264},
+  {TOUP, 3008},
+  {TOLO, 38864},
+  {TOUP, -6254},
+  {TOUP, -6253},
+  {TOUP, -6244},
+  {TOUP, -6242},
+  {TOUP, -6243},
+  {TOUP, -6236},
+  {TOUP, -6181},
+  {TOUP, 35266},
+  {TOLO, -3008},
+  {TOUP, 35332},
+  {TOUP, 3814},
+  {TOUP, -59},
+  {TOLO, -7615},
+  {TOUP, 8},
+  {TOLO, -8},
+  {TOUP, 74},
+  {TOUP, 86},
+  {TOUP, 100},
+  {TOUP, 128},
+  {TOUP, 112},
+  {TOUP, 126},
+  {TOUP, 9},
+  {TOLO, -74},
+  {TOLO, -9},
+  {TOUP, -7205},
+  {TOLO, -86},
+  {TOLO, -100},
+  {TOLO, -112},
+  {TOLO, -128},
+  {TOLO, -126},
+  {TOLO, -7517},
+  {TOLO, -8383},
+  {TOLO, -8262},
+  {TOLO, 28},
+  {TOUP, -28},
+  {TOLO, 16},
+  {TOUP, -16},
+  {TOLO, 26},
+  {TOUP, -26},
+  {TOLO, -10743},
+  {TOLO, -3814},
+  {TOLO, -10727},
+  {TOUP, -10795},
+  {TOUP, -10792},
+  {TOLO, -10780},
+  {TOLO, -10749},
+  {TOLO, -10783},
+  {TOLO, -10782},
+  {TOLO, -10815},
+  {TOUP, -7264},
+  {TOLO, -35332},
+  {TOLO, -42280},
+  {TOLO, -42308},
+  {TOLO, -42319},
+  {TOLO, -42315},
+  {TOLO, -42305},
+  {TOLO, -42258},
+  {TOLO, -42282},
+  {TOLO, -42261},
+  {TOLO, 928},
+  {TOUP, -928},
+  {TOUP, -38864},
+  {TOLO, 40},
+  {TOUP, -40},
+  {TOLO, 34},
+  {TOUP, -34},
+};
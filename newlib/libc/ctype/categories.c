@@ -2,6 +2,21 @@
 #include <stdint.h>
 #include "categories.h"
 
+#if !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+/* Three-stage table generated from categories.t by mktrie, about 18 KiB;
+   255 marks characters without category. */
+#include "categories_trie.t"
+
+enum category category(wint_t ucs)
+{
+  unsigned char cat;
+
+  if (ucs >= CATEGORY_TRIE_LIMIT)
+    return -1;
+  cat = category_trie(ucs);
+  return cat == 255 ? -1 : (enum category) cat;
+}
+#else
 struct _category {
   enum category cat: 8;
   uint_least32_t first: 24;
@@ -38,3 +53,4 @@ enum category category(wint_t ucs)
   return bisearch_cat(ucs, categories,
 		      sizeof(categories) / sizeof(*categories) - 1);
 }
+#endif
@@ -0,0 +1,924 @@
+/* generated by mktrie, do not edit */
+/* 897 + 3712 + 9968 entries */
+#define CATEGORY_TRIE_LIMIT 0xE0400
+static const unsigned char category_trie1[897] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 13, 13,
+  13, 13, 13, 14, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 15, 16, 17, 18, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 19, 20, 20, 21, 21, 21, 21, 21, 21, 22, 23,
+  24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 21, 21, 13, 34, 21, 21,
+  21, 35, 21, 21, 21, 21, 21, 21, 21, 21, 36, 37, 13, 13, 13, 13,
+  13, 38, 39, 21, 21, 21, 21, 21, 21, 21, 21, 21, 40, 21, 21, 41,
+  21, 21, 21, 21, 42, 43, 44, 21, 45, 21, 46, 47, 48, 49, 50, 21,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 51, 13, 13, 13, 52, 53, 13,
+  13, 13, 13, 54, 13, 13, 13, 13, 13, 13, 55, 21, 21, 21, 56, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  57,
+};
+static const unsigned short category_trie2[3712] = {
+  0, 0, 1, 2, 3, 4, 5, 6, 0, 0, 7, 8, 9, 10, 9, 11,
+  9, 9, 9, 12, 13, 9, 9, 9, 14, 15, 16, 17, 18, 9, 9, 19,
+  9, 9, 20, 21, 9, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+  33, 33, 33, 33, 33, 33, 33, 34, 35, 36, 37, 36, 9, 38, 9, 39,
+  9, 9, 9, 9, 9, 9, 9, 9, 40, 9, 9, 9, 9, 9, 9, 9,
+  9, 9, 9, 41, 9, 42, 36, 9, 43, 44, 33, 45, 46, 47, 48, 49,
+  50, 51, 47, 47, 52, 33, 53, 54, 47, 47, 47, 47, 47, 55, 56, 57,
+  58, 59, 47, 33, 60, 47, 47, 47, 47, 47, 61, 62, 63, 47, 64, 65,
+  47, 66, 67, 68, 47, 69, 70, 71, 71, 71, 47, 72, 71, 73, 74, 33,
+  75, 47, 47, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88,
+  89, 82, 83, 90, 91, 92, 93, 94, 95, 96, 83, 97, 98, 99, 87, 100,
+  101, 82, 83, 102, 103, 104, 87, 105, 106, 107, 108, 109, 110, 111, 93, 112,
+  113, 114, 83, 115, 116, 117, 87, 118, 119, 114, 83, 120, 121, 122, 87, 123,
+  124, 114, 47, 125, 126, 127, 87, 128, 129, 130, 47, 131, 132, 133, 93, 134,
+  135, 47, 47, 136, 137, 138, 71, 71, 139, 140, 141, 142, 143, 144, 71, 71,
+  145, 146, 147, 148, 149, 47, 150, 151, 152, 153, 33, 154, 155, 156, 71, 71,
+  47, 47, 157, 158, 159, 160, 161, 162, 163, 164, 9, 9, 165, 9, 9, 166,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 167, 168, 47, 47, 167, 47, 47, 169, 170, 171, 47, 47,
+  47, 170, 47, 47, 47, 172, 173, 174, 47, 175, 9, 9, 9, 9, 9, 176,
+  177, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 178, 47, 179, 180, 47, 47, 47, 47, 181, 182,
+  183, 184, 47, 185, 47, 186, 183, 187, 47, 47, 47, 188, 189, 190, 191, 192,
+  193, 191, 47, 47, 194, 47, 47, 195, 196, 47, 197, 47, 47, 47, 47, 198,
+  47, 199, 200, 201, 202, 47, 203, 204, 47, 47, 205, 47, 206, 207, 208, 208,
+  47, 209, 47, 47, 47, 210, 211, 212, 191, 191, 213, 214, 71, 71, 71, 71,
+  215, 47, 47, 216, 217, 159, 218, 219, 220, 47, 221, 63, 47, 47, 222, 223,
+  47, 47, 224, 225, 226, 63, 47, 227, 228, 9, 9, 229, 230, 231, 232, 233,
+  27, 27, 234, 28, 28, 28, 235, 236, 27, 237, 28, 28, 33, 33, 33, 238,
+  9, 9, 9, 9, 9, 9, 9, 9, 9, 239, 9, 9, 9, 9, 9, 9,
+  9, 176, 9, 9, 176, 240, 9, 241, 242, 242, 242, 243, 244, 245, 246, 247,
+  248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 258, 71, 259, 260, 261,
+  262, 263, 264, 265, 266, 267, 268, 268, 269, 270, 271, 208, 272, 273, 208, 274,
+  275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
+  276, 208, 277, 208, 208, 208, 208, 278, 208, 279, 275, 280, 208, 281, 282, 208,
+  208, 208, 283, 71, 284, 71, 267, 267, 267, 285, 208, 208, 208, 208, 286, 267,
+  208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 287, 288, 208, 208, 289,
+  208, 208, 208, 208, 208, 208, 290, 208, 208, 208, 208, 208, 208, 208, 208, 208,
+  208, 208, 208, 208, 208, 208, 291, 292, 267, 293, 208, 208, 294, 275, 295, 275,
+  208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
+  275, 275, 275, 275, 275, 275, 275, 275, 296, 297, 275, 275, 275, 298, 275, 299,
+  275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
+  208, 208, 208, 275, 300, 208, 208, 301, 208, 302, 208, 208, 303, 208, 208, 304,
+  9, 9, 305, 9, 9, 305, 9, 306, 9, 9, 9, 9, 9, 9, 307, 308,
+  9, 9, 165, 47, 47, 47, 309, 310, 47, 311, 312, 312, 312, 312, 33, 33,
+  313, 314, 315, 316, 317, 71, 71, 71, 208, 318, 208, 208, 208, 208, 208, 319,
+  208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 320, 71, 321,
+  322, 323, 324, 325, 135, 47, 47, 47, 47, 326, 177, 47, 47, 47, 47, 327,
+  328, 47, 47, 135, 47, 47, 47, 47, 199, 329, 47, 70, 208, 208, 319, 47,
+  208, 304, 330, 208, 331, 332, 208, 208, 330, 208, 208, 332, 208, 208, 208, 304,
+  208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 198, 208, 208, 208, 208,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 71,
+  47, 333, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 150, 208, 208, 208, 283, 47, 47, 227,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  334, 47, 335, 71, 9, 9, 336, 337, 9, 338, 47, 47, 47, 47, 339, 340,
+  32, 341, 342, 343, 9, 9, 9, 344, 345, 346, 347, 348, 71, 71, 71, 349,
+  350, 47, 351, 352, 47, 47, 47, 353, 354, 47, 47, 355, 356, 191, 33, 357,
+  63, 47, 358, 47, 359, 360, 47, 150, 75, 47, 47, 361, 362, 363, 364, 365,
+  47, 47, 366, 367, 368, 369, 47, 370, 47, 47, 47, 371, 372, 373, 374, 375,
+  376, 377, 312, 27, 27, 378, 379, 9, 9, 9, 9, 9, 47, 47, 380, 191,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 381, 47, 382, 47, 47, 205,
+  383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383,
+  383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383,
+  383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383,
+  383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 203, 47, 47, 47, 47, 47, 47, 206, 71, 71,
+  384, 385, 386, 387, 388, 47, 47, 47, 47, 47, 47, 389, 390, 391, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 392, 71, 47, 47, 47, 47, 393, 47, 47, 394, 71, 71, 395,
+  33, 396, 33, 397, 398, 399, 400, 401, 47, 47, 47, 47, 47, 47, 47, 402,
+  403, 2, 3, 4, 5, 404, 405, 406, 47, 407, 47, 199, 408, 409, 410, 411,
+  412, 47, 171, 413, 203, 203, 71, 71, 47, 47, 47, 47, 47, 47, 47, 70,
+  414, 267, 267, 415, 268, 268, 268, 416, 417, 321, 418, 71, 71, 208, 208, 419,
+  71, 71, 71, 71, 71, 71, 71, 71, 47, 150, 47, 47, 47, 99, 420, 421,
+  47, 47, 422, 47, 423, 47, 47, 424, 47, 425, 47, 47, 426, 427, 71, 71,
+  9, 9, 9, 9, 9, 47, 47, 47, 47, 203, 191, 9, 9, 428, 9, 429,
+  47, 47, 394, 47, 47, 47, 430, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 311, 47, 198, 394, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  431, 47, 47, 432, 47, 433, 47, 434, 47, 199, 435, 71, 71, 71, 47, 436,
+  47, 437, 47, 438, 71, 71, 71, 71, 47, 47, 47, 439, 267, 440, 267, 267,
+  441, 442, 47, 443, 444, 445, 47, 446, 47, 447, 71, 71, 448, 47, 449, 450,
+  47, 47, 47, 451, 47, 452, 47, 453, 47, 454, 455, 71, 71, 71, 71, 71,
+  47, 47, 47, 47, 195, 71, 71, 71, 9, 9, 9, 456, 9, 9, 9, 457,
+  47, 47, 458, 191, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 267, 459, 71, 71, 71, 71, 71, 71, 71, 71,
+  47, 447, 460, 47, 61, 461, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  462, 47, 47, 463, 464, 440, 465, 466, 220, 47, 47, 467, 468, 47, 195, 191,
+  469, 47, 470, 471, 472, 47, 47, 473, 220, 47, 47, 474, 475, 476, 477, 478,
+  47, 96, 479, 480, 71, 71, 71, 71, 481, 482, 483, 47, 47, 484, 485, 191,
+  486, 82, 83, 487, 488, 489, 490, 491, 71, 71, 71, 71, 71, 71, 71, 71,
+  47, 47, 47, 492, 493, 494, 71, 71, 47, 47, 47, 495, 496, 191, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 47, 47, 497, 498, 499, 500, 71, 71,
+  47, 47, 47, 501, 502, 191, 503, 71, 47, 47, 504, 505, 191, 71, 71, 71,
+  47, 172, 506, 507, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  47, 47, 479, 508, 71, 71, 71, 71, 71, 71, 9, 9, 9, 9, 147, 509,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  510, 47, 47, 511, 512, 513, 47, 47, 514, 515, 516, 71, 47, 47, 47, 195,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  83, 47, 497, 517, 518, 147, 174, 519, 47, 520, 521, 522, 71, 71, 71, 71,
+  523, 47, 47, 524, 525, 191, 526, 47, 527, 528, 191, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 47, 529,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 206, 71, 71, 71, 71, 71, 71,
+  268, 268, 268, 268, 268, 268, 530, 531, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 381, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  47, 47, 199, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 311, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 195, 47, 199, 363, 71, 71, 71, 71, 71, 71, 47, 203, 532,
+  47, 47, 47, 533, 534, 535, 536, 537, 47, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 9, 9, 9, 9, 267, 538, 71, 71, 71, 71, 71, 71,
+  47, 47, 47, 47, 204, 539, 540, 541, 466, 542, 71, 71, 71, 71, 543, 71,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 544,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 545,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 199, 71, 71, 71, 71, 71, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 205,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  47, 47, 47, 47, 47, 47, 70, 150, 195, 546, 547, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 320,
+  208, 208, 548, 208, 208, 208, 549, 550, 551, 208, 552, 208, 208, 208, 553, 71,
+  208, 208, 208, 208, 554, 71, 71, 71, 71, 71, 71, 71, 71, 71, 267, 555,
+  208, 208, 208, 208, 208, 283, 267, 444, 71, 71, 71, 71, 71, 71, 71, 71,
+  556, 557, 27, 558, 559, 560, 561, 556, 562, 563, 564, 565, 566, 556, 557, 27,
+  567, 568, 27, 569, 570, 571, 572, 556, 573, 27, 556, 557, 27, 558, 559, 27,
+  561, 556, 562, 572, 556, 573, 27, 556, 557, 27, 574, 556, 575, 576, 577, 578,
+  27, 579, 556, 580, 581, 582, 583, 27, 584, 556, 585, 27, 586, 587, 587, 587,
+  208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
+  208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
+  33, 33, 33, 588, 33, 33, 589, 590, 591, 592, 44, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  593, 594, 595, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 596, 597, 71, 71,
+  9, 9, 9, 9, 598, 363, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 477, 267, 267, 599, 600, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  601, 47, 602, 603, 604, 605, 606, 607, 608, 205, 609, 205, 71, 71, 71, 610,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  208, 208, 321, 208, 208, 208, 208, 208, 208, 319, 304, 611, 611, 611, 208, 320,
+  174, 208, 208, 208, 208, 208, 321, 208, 208, 208, 612, 71, 71, 71, 613, 208,
+  614, 208, 208, 321, 553, 615, 320, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 616,
+  208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
+  208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
+  208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 617, 612, 175,
+  208, 208, 208, 208, 208, 208, 208, 319, 208, 208, 208, 208, 208, 553, 71, 71,
+  321, 208, 208, 208, 618, 175, 208, 208, 618, 208, 619, 71, 71, 71, 71, 71,
+  321, 208, 208, 304, 208, 208, 208, 620, 208, 208, 614, 175, 614, 208, 208, 208,
+  71, 71, 71, 71, 71, 71, 619, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 311, 71, 71,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 204, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 203, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 544, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 99, 71,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 203, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  621, 71, 622, 622, 622, 622, 622, 622, 71, 71, 71, 71, 71, 71, 71, 71,
+  33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+};
+static const unsigned char category_trie3[9968] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  28, 20, 20, 20, 22, 20, 20, 20, 21, 17, 20, 24, 20, 16, 20, 20,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 20, 20, 24, 24, 24, 20,
+  20, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 21, 20, 17, 23, 15,
+  23, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 21, 24, 17, 24, 0,
+  28, 20, 22, 22, 22, 22, 25, 20, 23, 25, 6, 19, 24, 1, 25, 23,
+  25, 24, 14, 14, 23, 3, 20, 20, 23, 14, 6, 18, 14, 14, 14, 20,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 24, 3, 3, 3, 3, 3, 3, 3, 4,
+  3, 3, 3, 3, 3, 3, 3, 24, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 6, 3, 3, 4, 3,
+  6, 6, 6, 6, 3, 7, 3, 3, 7, 3, 3, 7, 3, 3, 3, 3,
+  4, 3, 7, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 4, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 4, 3, 3, 4, 3, 4, 3, 3, 4, 4, 4,
+  3, 3, 4, 3, 4, 3, 3, 4, 3, 3, 3, 3, 3, 4, 4, 3,
+  4, 3, 3, 4, 4, 3, 4, 4, 4, 4, 4, 4, 4, 3, 4, 4,
+  3, 4, 4, 3, 4, 4, 4, 3, 3, 3, 3, 3, 3, 4, 4, 4,
+  4, 4, 3, 4, 6, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  5, 5, 23, 23, 23, 23, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  5, 5, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+  5, 5, 5, 5, 5, 23, 23, 23, 23, 23, 23, 23, 5, 23, 5, 23,
+  23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  3, 3, 3, 3, 5, 23, 3, 3, 255, 255, 5, 3, 3, 3, 20, 3,
+  255, 255, 255, 255, 23, 23, 3, 20, 3, 3, 3, 255, 3, 255, 3, 3,
+  4, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 255, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 8, 8, 8, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 24, 3, 3, 3, 3, 3, 4, 3, 3, 3,
+  3, 3, 25, 11, 11, 11, 11, 11, 10, 10, 3, 3, 3, 3, 3, 3,
+  255, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 255, 255, 5, 20, 20, 20, 20, 20, 20,
+  3, 3, 3, 3, 3, 3, 3, 4, 4, 20, 16, 255, 255, 25, 25, 22,
+  255, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 16, 11,
+  20, 11, 11, 20, 11, 11, 20, 11, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 6,
+  6, 6, 6, 20, 20, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  1, 1, 1, 1, 1, 1, 24, 24, 24, 20, 20, 22, 20, 20, 25, 25,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 20, 1, 255, 20, 20,
+  5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 11, 11, 11, 11, 11,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 20, 20, 20, 20, 6, 6,
+  11, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 20, 6, 11, 11, 11, 11, 11, 11, 11, 1, 25, 11,
+  11, 11, 11, 11, 11, 5, 5, 11, 11, 25, 11, 11, 11, 11, 6, 6,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 6, 6, 6, 25, 25, 6,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 255, 1,
+  6, 11, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 255, 255, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 5, 5, 25, 20, 20, 20, 5, 255, 255, 11, 22, 22,
+  6, 6, 6, 6, 6, 6, 11, 11, 11, 11, 5, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 5, 11, 11, 11, 5, 11, 11, 11, 11, 11, 255, 255,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 11, 11, 11, 255, 255, 20, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 255, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255,
+  255, 255, 255, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 1, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 9, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 11, 9, 11, 6, 9, 9,
+  9, 11, 11, 11, 11, 11, 11, 11, 11, 9, 9, 9, 9, 11, 9, 9,
+  6, 11, 11, 11, 11, 11, 11, 11, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 11, 11, 20, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  20, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 11, 9, 9, 255, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 6,
+  6, 255, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 6, 6, 6, 6, 6,
+  6, 255, 6, 255, 255, 255, 6, 6, 6, 6, 255, 255, 11, 6, 9, 9,
+  9, 11, 11, 11, 11, 255, 255, 9, 9, 255, 255, 9, 9, 11, 6, 255,
+  255, 255, 255, 255, 255, 255, 255, 9, 255, 255, 255, 255, 6, 6, 255, 6,
+  6, 6, 11, 11, 255, 255, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  6, 6, 22, 22, 14, 14, 14, 14, 14, 14, 25, 22, 6, 20, 11, 255,
+  255, 11, 11, 9, 255, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 6,
+  6, 255, 6, 6, 255, 6, 6, 255, 6, 6, 255, 255, 11, 255, 9, 9,
+  9, 11, 11, 255, 255, 255, 255, 11, 11, 255, 255, 11, 11, 11, 255, 255,
+  255, 11, 255, 255, 255, 255, 255, 255, 255, 6, 6, 6, 6, 255, 6, 255,
+  255, 255, 255, 255, 255, 255, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  11, 11, 6, 6, 6, 11, 20, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 11, 11, 9, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6,
+  6, 6, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 255, 6, 6, 255, 6, 6, 6, 6, 6, 255, 255, 11, 6, 9, 9,
+  9, 11, 11, 11, 11, 11, 255, 11, 11, 9, 255, 9, 9, 11, 255, 255,
+  6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  20, 22, 255, 255, 255, 255, 255, 255, 255, 6, 11, 11, 11, 11, 11, 11,
+  255, 11, 9, 9, 255, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 6,
+  6, 255, 6, 6, 255, 6, 6, 6, 6, 6, 255, 255, 11, 6, 9, 11,
+  9, 11, 11, 11, 11, 255, 255, 9, 9, 255, 255, 9, 9, 11, 255, 255,
+  255, 255, 255, 255, 255, 255, 11, 9, 255, 255, 255, 255, 6, 6, 255, 6,
+  25, 6, 14, 14, 14, 14, 14, 14, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 11, 6, 255, 6, 6, 6, 6, 6, 6, 255, 255, 255, 6, 6,
+  6, 255, 6, 6, 6, 6, 255, 255, 255, 6, 6, 255, 6, 255, 6, 6,
+  255, 255, 255, 6, 6, 255, 255, 255, 6, 6, 6, 255, 255, 255, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 9, 9,
+  11, 9, 9, 255, 255, 255, 9, 9, 9, 255, 9, 9, 9, 11, 255, 255,
+  6, 255, 255, 255, 255, 255, 255, 9, 255, 255, 255, 255, 255, 255, 255, 255,
+  14, 14, 14, 25, 25, 25, 25, 25, 25, 22, 25, 255, 255, 255, 255, 255,
+  11, 9, 9, 9, 11, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 6,
+  6, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 6, 11, 11,
+  11, 9, 9, 9, 9, 255, 11, 11, 11, 255, 11, 11, 11, 11, 255, 255,
+  255, 255, 255, 255, 255, 11, 11, 255, 6, 6, 6, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 14, 14, 14, 14, 14, 14, 14, 25,
+  6, 11, 9, 9, 20, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 6,
+  6, 6, 6, 6, 255, 6, 6, 6, 6, 6, 255, 255, 11, 6, 9, 11,
+  9, 9, 9, 9, 9, 255, 11, 9, 9, 255, 9, 9, 11, 11, 255, 255,
+  255, 255, 255, 255, 255, 9, 9, 255, 255, 255, 255, 255, 255, 255, 6, 255,
+  255, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  11, 11, 9, 9, 255, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 11, 11, 6, 9, 9,
+  9, 11, 11, 11, 11, 255, 9, 9, 9, 255, 9, 9, 9, 11, 6, 25,
+  255, 255, 255, 255, 6, 6, 6, 9, 14, 14, 14, 14, 14, 14, 14, 6,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 25, 6, 6, 6, 6, 6, 6,
+  255, 255, 9, 9, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 6, 6, 6, 6, 6, 6,
+  6, 6, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 11, 255, 255, 255, 255, 9,
+  9, 9, 11, 11, 11, 255, 11, 255, 9, 9, 9, 9, 9, 9, 9, 9,
+  255, 255, 9, 9, 20, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 11, 6, 6, 11, 11, 11, 11, 11, 11, 11, 255, 255, 255, 255, 22,
+  6, 6, 6, 6, 6, 6, 5, 11, 11, 11, 11, 11, 11, 11, 11, 20,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 20, 20, 255, 255, 255, 255,
+  255, 6, 6, 255, 6, 255, 255, 6, 6, 255, 6, 255, 255, 6, 255, 255,
+  255, 255, 255, 255, 6, 6, 6, 6, 255, 6, 6, 6, 6, 6, 6, 6,
+  255, 6, 6, 6, 255, 6, 255, 6, 255, 255, 6, 6, 255, 6, 6, 6,
+  6, 11, 6, 6, 11, 11, 11, 11, 11, 11, 255, 11, 11, 6, 255, 255,
+  6, 6, 6, 6, 6, 255, 5, 255, 11, 11, 11, 11, 11, 11, 255, 255,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 255, 255, 6, 6, 6, 6,
+  6, 25, 25, 25, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 25, 20, 25, 25, 25, 11, 11, 25, 25, 25, 25, 25, 25,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 25, 11, 25, 11, 25, 11, 21, 17, 21, 17, 9, 9,
+  6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255,
+  255, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 9,
+  11, 11, 11, 11, 11, 20, 11, 11, 6, 6, 6, 6, 6, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 255, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 255, 25, 25,
+  25, 25, 25, 25, 25, 25, 11, 25, 25, 25, 25, 25, 25, 255, 25, 25,
+  20, 20, 20, 20, 20, 25, 25, 25, 25, 20, 20, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 9, 9, 11, 11, 11,
+  11, 9, 11, 11, 11, 11, 11, 11, 9, 11, 11, 9, 9, 11, 11, 6,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 20, 20, 20, 20, 20, 20,
+  6, 6, 6, 6, 6, 6, 9, 9, 11, 11, 6, 6, 6, 6, 11, 11,
+  11, 6, 9, 9, 9, 6, 6, 9, 9, 9, 9, 9, 9, 9, 6, 6,
+  6, 11, 11, 11, 11, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 11, 9, 9, 11, 11, 9, 9, 9, 9, 9, 9, 11, 6, 9,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 9, 9, 9, 11, 25, 25,
+  3, 3, 3, 3, 3, 3, 255, 3, 255, 255, 255, 255, 255, 3, 255, 255,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 20, 5, 3, 3, 3,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 6, 6, 6, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 255, 6, 255, 6, 6, 6, 6, 255, 255,
+  6, 255, 6, 6, 6, 6, 255, 255, 6, 6, 6, 6, 6, 6, 6, 255,
+  6, 255, 6, 6, 6, 6, 255, 255, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 255, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 11, 11, 11,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 255, 255, 255,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 255, 255, 255, 255, 255, 255,
+  3, 3, 3, 3, 3, 3, 255, 255, 3, 3, 3, 3, 3, 3, 255, 255,
+  16, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 20, 20, 6,
+  28, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 21, 17, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 20, 20, 20, 13, 13,
+  13, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 6,
+  6, 6, 11, 11, 11, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 11, 11, 11, 20, 20, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 11, 11, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 255, 11, 11, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 11, 11, 9, 11, 11, 11, 11, 11, 11, 11, 9, 9,
+  9, 9, 9, 9, 9, 9, 11, 9, 9, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 20, 20, 20, 5, 20, 20, 20, 22, 6, 11, 255, 255,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 255, 255, 255, 255, 255, 255,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 255, 255, 255, 255, 255, 255,
+  20, 20, 20, 20, 20, 20, 16, 20, 20, 20, 20, 11, 11, 11, 1, 255,
+  6, 6, 6, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 11, 11, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 11, 6, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255,
+  11, 11, 11, 9, 9, 9, 9, 11, 11, 9, 9, 9, 255, 255, 255, 255,
+  9, 9, 11, 9, 9, 9, 9, 9, 9, 11, 11, 11, 255, 255, 255, 255,
+  25, 255, 255, 255, 20, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255,
+  6, 6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 255, 255,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 14, 255, 255, 255, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  6, 6, 6, 6, 6, 6, 6, 11, 11, 9, 9, 11, 255, 255, 20, 20,
+  6, 6, 6, 6, 6, 9, 11, 9, 11, 11, 11, 11, 11, 11, 11, 255,
+  11, 9, 11, 9, 9, 11, 11, 11, 11, 11, 11, 11, 11, 9, 9, 9,
+  9, 9, 9, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 255, 255, 11,
+  20, 20, 20, 20, 20, 20, 20, 5, 20, 20, 20, 20, 20, 20, 255, 255,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 10, 255,
+  11, 11, 11, 11, 9, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 11, 9, 11, 11, 11, 11, 11, 9, 11, 9, 9, 9,
+  9, 9, 11, 9, 9, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255,
+  20, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 25, 25, 25, 25, 25, 25, 25, 25, 25, 255, 255, 255,
+  11, 11, 9, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 9, 11, 11, 11, 11, 9, 9, 11, 11, 9, 11, 11, 11, 6, 6,
+  6, 6, 6, 6, 6, 6, 11, 9, 11, 11, 9, 9, 9, 11, 9, 11,
+  11, 11, 9, 9, 255, 255, 255, 255, 255, 255, 255, 255, 20, 20, 20, 20,
+  6, 6, 6, 6, 9, 9, 9, 9, 9, 9, 9, 9, 11, 11, 11, 11,
+  11, 11, 11, 11, 9, 9, 11, 11, 255, 255, 255, 20, 20, 20, 20, 20,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 255, 255, 255, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 5, 5, 5, 5, 5, 5, 20, 20,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 255, 255, 255, 255, 255, 255, 255,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 255, 255, 3, 3, 3,
+  20, 20, 20, 20, 20, 20, 20, 20, 255, 255, 255, 255, 255, 255, 255, 255,
+  11, 11, 11, 20, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 9, 11, 11, 11, 11, 11, 11, 11, 6, 6, 6, 6, 11, 6, 6,
+  6, 6, 9, 9, 11, 6, 6, 9, 11, 11, 255, 255, 255, 255, 255, 255,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 5, 3, 4, 4, 4, 3, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 255, 11, 11, 11, 11, 11,
+  3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 3, 4, 4, 3, 4,
+  4, 3, 4, 3, 4, 3, 4, 3, 255, 3, 255, 3, 255, 3, 255, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 255, 255,
+  3, 3, 3, 3, 3, 3, 3, 3, 7, 7, 7, 7, 7, 7, 7, 7,
+  3, 3, 4, 3, 4, 255, 4, 4, 3, 3, 3, 3, 7, 23, 3, 23,
+  23, 23, 4, 3, 4, 255, 4, 4, 3, 3, 3, 3, 7, 23, 23, 23,
+  3, 3, 4, 4, 255, 255, 4, 4, 3, 3, 3, 3, 255, 23, 23, 23,
+  3, 3, 4, 4, 4, 3, 4, 4, 3, 3, 3, 3, 3, 23, 23, 23,
+  255, 255, 4, 3, 4, 255, 4, 4, 3, 3, 3, 3, 7, 23, 23, 255,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 1, 1, 1, 1, 1,
+  16, 16, 16, 16, 16, 16, 20, 20, 19, 18, 21, 19, 19, 18, 21, 19,
+  20, 20, 20, 20, 20, 20, 20, 20, 26, 27, 1, 1, 1, 1, 1, 28,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 19, 18, 20, 20, 20, 20, 15,
+  15, 20, 20, 20, 24, 21, 17, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 24, 20, 15, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 28,
+  1, 1, 1, 1, 1, 255, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  14, 5, 255, 255, 14, 14, 14, 14, 14, 14, 24, 24, 24, 21, 17, 5,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 24, 24, 24, 21, 17, 255,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 255, 255, 255,
+  22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 10, 10, 10,
+  10, 11, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  25, 25, 8, 25, 25, 25, 25, 8, 25, 25, 4, 8, 8, 8, 4, 4,
+  8, 8, 8, 4, 25, 8, 25, 25, 24, 8, 8, 8, 8, 8, 25, 25,
+  25, 25, 25, 25, 8, 25, 3, 25, 8, 25, 3, 3, 8, 8, 25, 4,
+  8, 8, 3, 8, 4, 6, 6, 6, 6, 4, 25, 25, 4, 4, 8, 8,
+  24, 24, 24, 24, 24, 8, 4, 4, 4, 4, 25, 24, 25, 25, 3, 25,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 3, 3, 13, 13, 13, 13, 14, 25, 25, 255, 255, 255, 255,
+  24, 24, 24, 24, 24, 25, 25, 25, 25, 25, 24, 24, 25, 25, 25, 25,
+  24, 25, 25, 24, 25, 25, 24, 25, 25, 25, 25, 25, 25, 25, 24, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 24, 24,
+  25, 25, 24, 25, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+  24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+  25, 25, 25, 25, 25, 25, 25, 25, 21, 17, 21, 17, 25, 25, 25, 25,
+  24, 24, 25, 25, 25, 25, 25, 25, 25, 21, 17, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 24, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 24, 24, 24, 24, 24,
+  24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 24, 24, 24, 24,
+  24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 255, 255, 255, 255, 255,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 14, 14, 14, 14, 14, 14,
+  25, 25, 25, 25, 25, 25, 25, 24, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 24, 24, 24, 24, 24, 24, 24, 24,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 24,
+  25, 25, 25, 25, 25, 25, 25, 25, 21, 17, 21, 17, 21, 17, 21, 17,
+  21, 17, 21, 17, 21, 17, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  24, 24, 24, 24, 24, 21, 17, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+  24, 24, 24, 24, 24, 24, 21, 17, 21, 17, 21, 17, 21, 17, 21, 17,
+  24, 24, 24, 21, 17, 21, 17, 21, 17, 21, 17, 21, 17, 21, 17, 21,
+  17, 21, 17, 21, 17, 21, 17, 21, 17, 24, 24, 24, 24, 24, 24, 24,
+  24, 24, 24, 24, 24, 24, 24, 24, 21, 17, 21, 17, 24, 24, 24, 24,
+  24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 21, 17, 24, 24,
+  24, 24, 24, 24, 24, 25, 25, 24, 24, 24, 24, 24, 24, 25, 25, 25,
+  25, 25, 25, 25, 255, 255, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 255, 255, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 255, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 255,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 255,
+  3, 4, 3, 3, 4, 3, 3, 4, 4, 4, 4, 4, 5, 5, 3, 3,
+  3, 3, 3, 3, 4, 25, 25, 25, 25, 25, 25, 3, 3, 3, 3, 11,
+  11, 11, 3, 3, 255, 255, 255, 255, 255, 20, 20, 20, 20, 14, 20, 20,
+  6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 5,
+  20, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 11,
+  6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 255, 6, 6, 6, 6, 6, 6, 6, 255,
+  20, 20, 19, 18, 19, 18, 20, 20, 20, 19, 18, 20, 19, 18, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 16, 20, 20, 16, 20, 19, 18, 20, 20,
+  19, 18, 21, 17, 21, 17, 21, 17, 21, 17, 20, 20, 20, 20, 20, 5,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 16, 16, 20, 20, 20, 20,
+  16, 20, 21, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 255,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 255, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  25, 25, 25, 25, 25, 25, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 255, 255, 255, 255,
+  28, 20, 20, 20, 25, 5, 6, 13, 21, 17, 21, 17, 21, 17, 21, 17,
+  21, 17, 25, 25, 21, 17, 21, 17, 21, 17, 21, 17, 16, 21, 17, 17,
+  25, 13, 13, 13, 13, 13, 13, 13, 13, 13, 11, 11, 11, 11, 9, 9,
+  16, 5, 5, 5, 5, 5, 25, 25, 13, 13, 13, 5, 6, 20, 25, 25,
+  6, 6, 6, 6, 6, 6, 6, 255, 255, 11, 11, 23, 23, 5, 5, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 20, 5, 5, 5, 6,
+  255, 255, 255, 255, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  25, 25, 14, 14, 14, 14, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 14, 14, 14, 14, 14, 14, 14, 14,
+  25, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  6, 6, 6, 6, 6, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 5, 20, 20, 20,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 6, 6, 255, 255, 255, 255,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 6, 11,
+  10, 10, 10, 20, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 20, 5,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 5, 5, 11, 11,
+  6, 6, 6, 6, 6, 6, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  11, 11, 20, 20, 20, 20, 20, 20, 255, 255, 255, 255, 255, 255, 255, 255,
+  23, 23, 23, 23, 23, 23, 23, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  23, 23, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  4, 4, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  5, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 5, 23, 23, 3, 3, 3, 4, 6,
+  3, 3, 3, 3, 4, 4, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 6, 5, 5, 4, 6, 6, 6, 6, 6,
+  6, 6, 11, 6, 6, 6, 11, 6, 6, 6, 6, 11, 6, 6, 6, 6,
+  6, 6, 6, 9, 9, 11, 11, 9, 25, 25, 25, 25, 255, 255, 255, 255,
+  14, 14, 14, 14, 14, 14, 25, 25, 22, 25, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 20, 20, 20, 20, 255, 255, 255, 255, 255, 255, 255, 255,
+  9, 9, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+  9, 9, 9, 9, 11, 11, 255, 255, 255, 255, 255, 255, 255, 255, 20, 20,
+  11, 11, 6, 6, 6, 6, 6, 6, 20, 20, 20, 6, 20, 6, 6, 11,
+  6, 6, 6, 6, 6, 6, 11, 11, 11, 11, 11, 11, 11, 11, 20, 20,
+  6, 6, 6, 6, 6, 6, 6, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 9, 9, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 20,
+  6, 6, 6, 11, 9, 9, 11, 11, 11, 11, 9, 9, 11, 9, 9, 9,
+  9, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 255, 5,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 255, 255, 255, 255, 20, 20,
+  6, 6, 6, 6, 6, 11, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 6, 6, 6, 6, 6, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 11, 11, 11, 11, 11, 11, 9,
+  9, 11, 11, 9, 9, 11, 11, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 11, 6, 6, 6, 6, 6, 6, 6, 6, 11, 9, 255, 255,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 255, 255, 20, 20, 20, 20,
+  5, 6, 6, 6, 6, 6, 6, 25, 25, 25, 6, 9, 11, 9, 6, 6,
+  11, 6, 11, 11, 11, 6, 6, 11, 11, 6, 6, 6, 6, 6, 11, 11,
+  6, 11, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 6, 6, 5, 20, 20,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 9, 11, 11, 9, 9,
+  20, 20, 6, 5, 5, 9, 11, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 6, 6, 6, 6, 6, 6, 255, 255, 6, 6, 6, 6, 6, 6, 255,
+  255, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  4, 4, 4, 3, 4, 4, 4, 4, 4, 4, 4, 23, 5, 5, 5, 5,
+  4, 4, 4, 4, 4, 4, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 9, 9, 11, 9, 9, 11, 9, 9, 20, 9, 11, 255, 255,
+  6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 6, 6, 6, 6, 6,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 4, 4, 4, 4, 4, 255, 255, 255, 255, 255, 6, 11, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 24, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 255, 6, 6, 6, 6, 6, 255, 6, 255,
+  6, 6, 255, 6, 6, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+  23, 23, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 17, 21,
+  255, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 22, 25, 255, 255,
+  20, 20, 20, 20, 20, 20, 20, 21, 17, 20, 255, 255, 255, 255, 255, 255,
+  20, 16, 16, 15, 15, 21, 17, 21, 17, 21, 17, 21, 17, 21, 17, 21,
+  17, 21, 17, 21, 17, 20, 20, 21, 17, 20, 20, 20, 20, 15, 15, 15,
+  20, 20, 20, 255, 20, 20, 20, 20, 16, 21, 17, 21, 17, 21, 17, 20,
+  20, 20, 24, 16, 24, 24, 24, 255, 20, 22, 20, 20, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 1,
+  255, 20, 20, 20, 22, 20, 20, 20, 21, 17, 20, 24, 20, 16, 20, 20,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 21, 24, 17, 24, 21,
+  17, 20, 21, 17, 20, 20, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 5, 5,
+  255, 255, 6, 6, 6, 6, 6, 6, 255, 255, 6, 6, 6, 6, 6, 6,
+  255, 255, 6, 6, 6, 6, 6, 6, 255, 255, 6, 6, 6, 255, 255, 255,
+  22, 22, 24, 23, 25, 22, 22, 255, 25, 24, 24, 24, 24, 25, 25, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 1, 1, 25, 25, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 6, 255, 6,
+  20, 20, 20, 255, 255, 255, 255, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 255, 255, 255, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  13, 13, 13, 13, 13, 14, 14, 14, 14, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 14, 14, 25, 25, 25, 255,
+  25, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 11, 255, 255,
+  11, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 255, 255, 255, 255,
+  14, 14, 14, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 6, 6, 6,
+  6, 13, 6, 6, 6, 6, 6, 6, 6, 6, 13, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 11, 11, 11, 11, 11, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 20,
+  6, 6, 6, 6, 255, 255, 255, 255, 6, 6, 6, 6, 6, 6, 6, 6,
+  20, 13, 13, 13, 13, 13, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  3, 3, 3, 3, 255, 255, 255, 255, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 255, 255, 255, 255,
+  6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 20,
+  6, 6, 6, 6, 6, 6, 255, 255, 6, 255, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 255, 6, 6, 255, 255, 255, 6, 255, 255, 6,
+  6, 6, 6, 6, 6, 6, 255, 20, 14, 14, 14, 14, 14, 14, 14, 14,
+  6, 6, 6, 6, 6, 6, 6, 25, 25, 14, 14, 14, 14, 14, 14, 14,
+  255, 255, 255, 255, 255, 255, 255, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  6, 6, 6, 255, 6, 6, 255, 255, 255, 255, 255, 14, 14, 14, 14, 14,
+  6, 6, 6, 6, 6, 6, 14, 14, 14, 14, 14, 14, 255, 255, 255, 20,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 255, 20,
+  6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 14, 14, 6, 6,
+  255, 255, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  6, 11, 11, 11, 255, 11, 11, 255, 255, 255, 255, 255, 11, 11, 11, 11,
+  6, 6, 6, 6, 255, 6, 6, 6, 255, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 255, 255, 11, 11, 11, 255, 255, 255, 255, 11,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 255, 255, 255, 255, 255, 255, 255,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 14, 14, 20,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 14, 14, 14,
+  6, 6, 6, 6, 6, 6, 6, 6, 25, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 11, 11, 255, 255, 255, 255, 14, 14, 14, 14, 14,
+  20, 20, 20, 20, 20, 20, 20, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 255, 255, 255, 20, 20, 20, 20, 20, 20, 20,
+  6, 6, 6, 6, 6, 6, 255, 255, 14, 14, 14, 14, 14, 14, 14, 14,
+  6, 6, 6, 255, 255, 255, 255, 255, 14, 14, 14, 14, 14, 14, 14, 14,
+  6, 6, 255, 255, 255, 255, 255, 255, 255, 20, 20, 20, 20, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 14, 14, 14, 14, 14, 14,
+  3, 3, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  3, 3, 3, 255, 255, 255, 255, 255, 255, 255, 14, 14, 14, 14, 14, 14,
+  6, 6, 6, 6, 11, 11, 11, 11, 255, 255, 255, 255, 255, 255, 255, 255,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 255,
+  14, 14, 14, 14, 14, 14, 14, 6, 255, 255, 255, 255, 255, 255, 255, 255,
+  11, 14, 14, 14, 14, 20, 20, 20, 20, 20, 255, 255, 255, 255, 255, 255,
+  9, 11, 9, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 20, 20, 20, 20, 20, 20, 20, 255, 255,
+  14, 14, 14, 14, 14, 14, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 11,
+  9, 9, 9, 11, 11, 11, 11, 9, 9, 11, 11, 20, 20, 1, 20, 20,
+  20, 20, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 255, 255,
+  11, 11, 11, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 11, 11, 11, 11, 11, 9, 11, 11, 11,
+  11, 11, 11, 11, 11, 255, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  20, 20, 20, 20, 6, 9, 9, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 11, 20, 20, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 9, 9, 9, 11, 11, 11, 11, 11, 11, 11, 11, 11, 9,
+  9, 6, 6, 6, 6, 20, 20, 20, 20, 11, 11, 11, 11, 20, 255, 255,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 6, 20, 6, 20, 20, 20,
+  255, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 9, 9, 9, 11,
+  11, 11, 9, 9, 11, 9, 11, 11, 20, 20, 20, 20, 20, 20, 11, 255,
+  6, 6, 6, 6, 6, 6, 6, 255, 6, 255, 6, 6, 6, 6, 255, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 20, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 11,
+  9, 9, 9, 11, 11, 11, 11, 11, 11, 11, 11, 255, 255, 255, 255, 255,
+  11, 11, 9, 9, 255, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 6,
+  6, 255, 6, 6, 255, 6, 6, 6, 6, 6, 255, 11, 11, 6, 9, 9,
+  11, 9, 9, 9, 9, 255, 255, 9, 9, 255, 255, 9, 9, 9, 255, 255,
+  6, 255, 255, 255, 255, 255, 255, 9, 255, 255, 255, 255, 255, 6, 6, 6,
+  6, 6, 9, 9, 255, 255, 11, 11, 11, 11, 11, 11, 11, 255, 255, 255,
+  11, 11, 11, 11, 11, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 9, 9, 9, 11, 11, 11, 11, 11, 11, 11, 11,
+  9, 9, 11, 11, 11, 9, 11, 6, 6, 6, 6, 20, 20, 20, 20, 20,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 255, 20, 255, 20, 11, 255,
+  9, 9, 9, 11, 11, 11, 11, 11, 11, 9, 11, 9, 9, 9, 9, 11,
+  11, 9, 11, 11, 6, 6, 20, 6, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 9,
+  9, 9, 11, 11, 11, 11, 255, 255, 9, 9, 9, 9, 11, 11, 9, 11,
+  11, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 6, 6, 6, 6, 11, 11, 255, 255,
+  9, 9, 9, 11, 11, 11, 11, 11, 11, 11, 11, 9, 9, 11, 9, 11,
+  11, 20, 20, 20, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 11, 9, 11, 9, 9,
+  11, 11, 11, 11, 11, 11, 9, 11, 255, 255, 255, 255, 255, 255, 255, 255,
+  9, 9, 11, 11, 11, 11, 9, 11, 11, 11, 11, 11, 255, 255, 255, 255,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 14, 14, 20, 20, 20, 25,
+  11, 11, 11, 11, 11, 11, 11, 11, 9, 11, 11, 20, 255, 255, 255, 255,
+  14, 14, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 6,
+  6, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 6, 6, 6, 6, 6,
+  6, 6, 6, 11, 11, 11, 11, 11, 11, 9, 6, 11, 11, 11, 11, 20,
+  20, 20, 20, 20, 20, 20, 20, 11, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 11, 11, 11, 11, 11, 11, 9, 9, 11, 11, 11, 6, 6, 6, 6,
+  6, 6, 6, 6, 255, 255, 6, 6, 6, 6, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 9, 11, 11, 20, 20, 20, 6, 20, 20,
+  20, 20, 20, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  11, 11, 11, 11, 11, 11, 11, 255, 11, 11, 11, 11, 11, 11, 9, 11,
+  6, 20, 20, 20, 20, 20, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  20, 20, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  255, 255, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 255, 9, 11, 11, 11, 11, 11, 11,
+  11, 9, 11, 11, 9, 11, 11, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 255, 6, 6, 255, 6, 6, 6, 6, 6,
+  6, 11, 11, 11, 11, 11, 11, 255, 255, 255, 11, 255, 11, 11, 255, 11,
+  11, 11, 11, 11, 11, 11, 6, 11, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 255, 6, 6, 255, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 9, 9, 9, 9, 9, 255,
+  11, 11, 255, 9, 9, 11, 9, 11, 6, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 11, 11, 9, 9, 20, 20, 255, 255, 255, 255, 255, 255, 255,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 255,
+  20, 20, 20, 20, 20, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  11, 11, 11, 11, 11, 20, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  11, 11, 11, 11, 11, 11, 11, 20, 20, 20, 20, 20, 25, 25, 25, 25,
+  5, 5, 5, 5, 20, 25, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 255, 14, 14, 14, 14, 14,
+  14, 14, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 255, 6, 6, 6,
+  14, 14, 14, 14, 14, 14, 14, 20, 20, 20, 20, 255, 255, 255, 255, 255,
+  6, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+  9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+  9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 255,
+  11, 11, 11, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  5, 5, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 25, 11, 11, 20,
+  1, 1, 1, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  25, 25, 25, 25, 25, 25, 25, 255, 255, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 9, 9, 11, 11, 11, 25, 25, 25, 9, 9, 9,
+  9, 9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 11, 11, 11, 11, 11,
+  11, 11, 11, 25, 25, 11, 11, 11, 11, 11, 11, 11, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 11, 11, 11, 11, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 255, 255, 255, 255, 255, 255, 255,
+  25, 25, 11, 11, 11, 25, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  14, 14, 14, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4, 4,
+  4, 4, 4, 4, 4, 255, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 8, 255, 8, 8,
+  255, 255, 8, 255, 255, 8, 8, 255, 255, 8, 8, 8, 8, 255, 8, 8,
+  8, 8, 8, 8, 8, 8, 4, 4, 4, 4, 255, 4, 255, 4, 4, 4,
+  4, 4, 4, 4, 255, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 8, 8, 255, 8, 8, 8, 8, 255, 255, 8, 8, 8,
+  8, 8, 8, 8, 8, 255, 8, 8, 8, 8, 8, 8, 8, 255, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 8, 8, 255, 8, 8, 8, 8, 255,
+  8, 8, 8, 8, 8, 255, 8, 255, 255, 255, 8, 8, 8, 8, 8, 8,
+  8, 255, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 255, 255, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 24, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 24, 4, 4, 4, 4,
+  4, 4, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 24, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 24, 4, 4, 4, 4, 4, 4, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 24, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 24,
+  4, 4, 4, 4, 4, 4, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 24,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 24, 4, 4, 4, 4, 4, 4,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 24, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 24, 4, 4, 4, 4, 4, 4, 8, 4, 255, 255, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  11, 11, 11, 11, 11, 11, 11, 25, 25, 25, 25, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 25, 25, 25,
+  25, 25, 25, 25, 25, 11, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 11, 25, 25, 20, 20, 20, 20, 20, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 255, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 255, 255, 11, 11, 11, 11, 11,
+  11, 11, 255, 11, 11, 255, 11, 11, 11, 11, 11, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 255, 255, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  11, 11, 11, 11, 11, 11, 11, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  3, 3, 3, 3, 11, 11, 11, 11, 11, 11, 11, 255, 255, 255, 255, 255,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 25, 14, 14, 14,
+  22, 14, 14, 14, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  255, 6, 6, 255, 6, 255, 255, 6, 255, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 255, 6, 6, 6, 6, 255, 6, 255, 6, 255, 255, 255, 255,
+  255, 255, 6, 255, 255, 255, 255, 6, 255, 6, 255, 6, 255, 6, 6, 6,
+  255, 6, 6, 255, 6, 255, 255, 6, 255, 6, 255, 6, 255, 6, 255, 6,
+  255, 6, 6, 255, 6, 255, 255, 6, 6, 6, 6, 255, 6, 6, 6, 6,
+  6, 6, 6, 255, 6, 6, 6, 6, 255, 6, 6, 6, 6, 255, 6, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 6, 6, 6, 6,
+  255, 6, 6, 6, 255, 6, 6, 6, 6, 6, 255, 6, 6, 6, 6, 6,
+  24, 24, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  25, 25, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 23, 23, 23, 23, 23,
+  25, 25, 25, 25, 25, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  25, 25, 25, 25, 25, 25, 25, 25, 255, 255, 255, 255, 255, 255, 255, 255,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 255, 255,
+  25, 255, 255, 25, 25, 25, 25, 255, 255, 255, 25, 255, 25, 25, 25, 25,
+  255, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+};
+#define category_trie(c) \
+  category_trie3[category_trie2[category_trie1[(c) >> 10] << 6 | ((c) >> 4 & 63)] << 4 \
+	     | ((c) & 15)]
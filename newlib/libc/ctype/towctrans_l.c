@@ -35,6 +35,27 @@
  */
 enum {TO1, TOLO, TOUP, TOBOTH};
 enum {EVENCAP, ODDCAP};
+#if !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+/* Three-stage table generated from caseconv.t by mktrie, about 4 KiB.
+   It maps each character to an entry of caseconv_rules, which holds the
+   distinct (mode, delta) pairs of caseconv.t; 0 means no conversion. */
+struct caseconv_entry {
+  unsigned char mode;
+  int_least32_t delta;
+};
+#include "caseconv_trie.t"
+
+static const struct caseconv_entry *
+lookup (wint_t ucs)
+{
+  unsigned char rule;
+
+  if (ucs >= CASECONV_TRIE_LIMIT)
+    return 0;
+  rule = caseconv_trie(ucs);
+  return rule ? &caseconv_rules[rule - 1] : 0;
+}
+#else
 static struct caseconv_entry {
   uint_least32_t first: 21;
   uint_least32_t diff: 8;
@@ -69,12 +90,18 @@ bisearch (wint_t ucs, const struct caseconv_entry *table, int max)
   return 0;
 }
 
+static const struct caseconv_entry *
+lookup (wint_t ucs)
+{
+  return bisearch(ucs, caseconv_table,
+		  sizeof(caseconv_table) / sizeof(*caseconv_table) - 1);
+}
+#endif
+
 static wint_t
 toulower (wint_t c)
 {
-  const struct caseconv_entry * cce =
-    bisearch(c, caseconv_table,
-             sizeof(caseconv_table) / sizeof(*caseconv_table) - 1);
+  const struct caseconv_entry * cce = lookup (c);
 
   if (cce)
     switch (cce->mode)
@@ -107,9 +134,7 @@ toulower (wint_t c)
 static wint_t
 touupper (wint_t c)
 {
-  const struct caseconv_entry * cce =
-    bisearch(c, caseconv_table,
-             sizeof(caseconv_table) / sizeof(*caseconv_table) - 1);
+  const struct caseconv_entry * cce = lookup (c);
 
   if (cce)
     switch (cce->mode)
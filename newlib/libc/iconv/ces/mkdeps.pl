@@ -35,6 +35,8 @@ sub next_entry($$$);
 sub generate_cesbi_h($$);
 sub generate_encnames_h(@);
 sub generate_aliasesbi_c($);
+sub alias_hash($);
+sub alias_hash_slot($$);
 sub generate_encoding_aliases_c($);
 sub generate_cesdeps_h($);
 sub generate_ccsbi_h($);
@@ -66,6 +68,13 @@ my $var_to_ucs_handlers   = '_iconv_to_ucs_ces_handlers_';
 my $var_ccs       = '_iconv_ccs_';
 my $var_aliases   = '_iconv_aliases';
 my $var_ces_names = 'iconv_ces_names_';
+my $var_aliases_disp = '_iconv_aliases_disp';
+my $var_aliases_hash = '_iconv_aliases_hash';
+
+# Must match ICONV_ALIASES_HASH_BUCKETS and ICONV_ALIASES_HASH_BITS in
+# ../lib/local.h.
+my $aliases_hash_buckets = 64;
+my $aliases_hash_bits    = 8;
 
 # ==============================================================================
 #
@@ -583,9 +592,10 @@ sub generate_aliasesbi_c($)
 
   print ALIASESBI_C "$comment_automatic\n\n";
   print ALIASESBI_C "#include <_ansi.h>\n";
+  print ALIASESBI_C "#include \"local.h\"\n";
   print ALIASESBI_C "#include \"encnames.h\"\n\n";
-  print ALIASESBI_C "const char *\n";
-  print ALIASESBI_C "$var_aliases =\n";
+  print ALIASESBI_C "const char\n";
+  print ALIASESBI_C "${var_aliases}[] =\n";
   print ALIASESBI_C "{\n";
 
   foreach my $enc (sort keys %{$_[0]})
@@ -599,10 +609,121 @@ sub generate_aliasesbi_c($)
   }
   print ALIASESBI_C "  \"\"\n";
   print ALIASESBI_C "};\n\n";
-  
+
+  # Build a perfect hash over the names of all known encodings: names are
+  # distributed into buckets and, starting with the largest bucket, each
+  # bucket gets the first displacement which moves all of its names into
+  # free slots. Names canonical_form() can't produce are left out.
+  my %slot;
+  my %bucket;
+  my @disp = (0) x $aliases_hash_buckets;
+
+  foreach my $enc (keys %{$_[0]})
+  {
+    my @names = ($enc);
+    push @names, split (' ', ${$_[0]}{$enc}) if defined ${$_[0]}{$enc};
+    foreach my $name (@names)
+    {
+      next if $name =~ m/[A-Z\-]/;
+      push @{$bucket{alias_hash ($name) & ($aliases_hash_buckets - 1)}},
+           [$name, $enc];
+    }
+  }
+
+  my %used;
+  foreach my $b (sort { @{$bucket{$b}} <=> @{$bucket{$a}} || $a <=> $b }
+                 keys %bucket)
+  {
+    my $d;
+    for ($d = 0; $d < 256; $d++)
+    {
+      my %try;
+      foreach my $e (@{$bucket{$b}})
+      {
+        my $s = alias_hash_slot (alias_hash ($e->[0]), $d);
+        last if $used{$s} or $try{$s};
+        $try{$s} = $e;
+      }
+      next if keys %try != @{$bucket{$b}};
+      foreach my $s (keys %try)
+      {
+        $used{$s} = 1;
+        $slot{$try{$s}->[0]} = $s;
+      }
+      last;
+    }
+    err "Can't build the encoding names hash, increase "
+      . "\$aliases_hash_bits in mkdeps.pl and ICONV_ALIASES_HASH_BITS"
+    if $d == 256;
+    $disp[$b] = $d;
+  }
+
+  print ALIASESBI_C "#ifdef ICONV_ALIASES_HASH\n";
+  print ALIASESBI_C "const unsigned char\n";
+  print ALIASESBI_C "${var_aliases_disp}[ICONV_ALIASES_HASH_BUCKETS] =\n";
+  print ALIASESBI_C "{\n";
+  for (my $i = 0; $i < $aliases_hash_buckets; $i += 16)
+  {
+    print ALIASESBI_C "  " . join (", ", @disp[$i .. $i + 15]) . ",\n";
+  }
+  print ALIASESBI_C "};\n\n";
+
+  print ALIASESBI_C "const iconv_alias_t\n";
+  print ALIASESBI_C "${var_aliases_hash}[1 << ICONV_ALIASES_HASH_BITS] =\n";
+  print ALIASESBI_C "{\n";
+  foreach my $enc (sort keys %{$_[0]})
+  {
+    my @names;
+    push @names, split (' ', ${$_[0]}{$enc}) if defined ${$_[0]}{$enc};
+    print ALIASESBI_C "#if defined ($macro_from_enc\U$enc) \\\n";
+    print ALIASESBI_C " || defined ($macro_to_enc\U$enc)\n";
+    print ALIASESBI_C "  [$slot{$enc}] = {$macro_enc_name\U$enc\E, $slot{$enc}},\n";
+    foreach my $name (@names)
+    {
+      next if not defined $slot{$name};
+      print ALIASESBI_C "  [$slot{$name}] = {\"$name\", $slot{$enc}},\n";
+    }
+    print ALIASESBI_C "#endif\n";
+  }
+  print ALIASESBI_C "};\n";
+  print ALIASESBI_C "#endif /* ICONV_ALIASES_HASH */\n\n";
+
   close ALIASESBI_C or err "Error while closing ../lib/aliasesbi.c file.";
 }
 
+# ==============================================================================
+#
+# Hash function for encoding names, same as in _iconv_find_encoding_name().
+#
+# Parameter 1: encoding name.
+#
+# ==============================================================================
+sub alias_hash($)
+{
+  my $h = 2166136261;
+
+  foreach my $c (unpack ("C*", $_[0]))
+  {
+    $h = (($h ^ $c) * 16777619) & 0xffffffff;
+  }
+
+  return $h;
+}
+
+# ==============================================================================
+#
+# Slot of a name in the encoding names hash, same as ICONV_ALIASES_HASH_SLOT.
+#
+# Parameter 1: alias_hash() value of the name.
+# Parameter 2: displacement of the name's bucket.
+#
+# ==============================================================================
+sub alias_hash_slot($$)
+{
+  return ((($_[0] ^ $_[1]) * 0x61C88647) & 0xffffffff)
+         >> (32 - $aliases_hash_bits);
+}
+
 # ==============================================================================
 #
 # Generate encoding.aliases file.
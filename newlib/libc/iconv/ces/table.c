@@ -165,6 +165,59 @@ table_convert_from_ucs (void *data,
   *outbytesleft -= 2;
   return 2; 
 }
+
+#ifdef ICONV_BLOCK_CONVERSION
+static size_t
+table_convert_from_ucs_block (void *data,
+                                     const ucs4_t *in,
+                                     size_t n,
+                                     unsigned char **outbuf,
+                                     size_t *outbytesleft)
+{
+  const iconv_ccs_desc_t *ccsp = (iconv_ccs_desc_t *)data;
+  unsigned char *cp = *outbuf;
+  ucs2_t code;
+  size_t i;
+
+  if (ccsp->bits == TABLE_8BIT)
+    {
+      const unsigned char *tblp = (const unsigned char *)ccsp->tbl;
+
+      if (n > *outbytesleft)
+        n = *outbytesleft;
+      for (i = 0; i < n; i++)
+        {
+          if (in[i] > 0xFFFF || in[i] == INVALC
+              || (code = find_code_speed_8bit ((ucs2_t)in[i], tblp)) == INVALC)
+            break;
+          *cp++ = (unsigned char)code;
+        }
+    }
+  else
+    {
+      if (n > *outbytesleft / 2)
+        n = *outbytesleft / 2;
+      for (i = 0; i < n; i++)
+        {
+          if (in[i] > 0xFFFF || in[i] == INVALC)
+            break;
+          if (ccsp->optimization == TABLE_SPEED_OPTIMIZED)
+            code = find_code_speed ((ucs2_t)in[i], ccsp->tbl);
+          else
+            code = find_code_size ((ucs2_t)in[i], ccsp->tbl);
+          if (code == INVALC)
+            break;
+          *cp++ = (unsigned char)((ucs2_t)code >> 8);
+          *cp++ = (unsigned char)code;
+        }
+    }
+
+  *outbytesleft -= cp - *outbuf;
+  *outbuf = cp;
+
+  return i;
+}
+#endif /* ICONV_BLOCK_CONVERSION */
 #endif /* ICONV_FROM_UCS_CES_TABLE */
 
 #if defined (ICONV_TO_UCS_CES_TABLE)
@@ -245,6 +298,60 @@ table_convert_to_ucs (void *data,
   *inbytesleft -= 2;
   return (ucs4_t)ucs; 
 }
+
+#ifdef ICONV_BLOCK_CONVERSION
+static size_t
+table_convert_to_ucs_block (void *data,
+                                   const unsigned char **inbuf,
+                                   size_t *inbytesleft,
+                                   ucs4_t *out,
+                                   unsigned char *lens,
+                                   size_t n)
+{
+  const iconv_ccs_desc_t *ccsp = (iconv_ccs_desc_t *)data;
+  const unsigned char *cp = *inbuf;
+  ucs2_t ucs;
+  size_t i;
+
+  if (ccsp->bits == TABLE_8BIT)
+    {
+      if (n > *inbytesleft)
+        n = *inbytesleft;
+      for (i = 0; i < n; i++)
+        {
+          if ((ucs = (ucs2_t)ccsp->tbl[cp[i]]) == INVALC)
+            break;
+          out[i] = (ucs4_t)ucs;
+          lens[i] = 1;
+        }
+      cp += i;
+    }
+  else
+    {
+      if (n > *inbytesleft / 2)
+        n = *inbytesleft / 2;
+      for (i = 0; i < n; i++)
+        {
+          if (ccsp->optimization == TABLE_SIZE_OPTIMIZED)
+            ucs = find_code_size ((ucs2_t)cp[0] << 8 | (ucs2_t)cp[1],
+                                  ccsp->tbl);
+          else
+            ucs = find_code_speed ((ucs2_t)cp[0] << 8 | (ucs2_t)cp[1],
+                                   ccsp->tbl);
+          if (ucs == INVALC)
+            break;
+          out[i] = (ucs4_t)ucs;
+          lens[i] = 2;
+          cp += 2;
+        }
+    }
+
+  *inbytesleft -= cp - *inbuf;
+  *inbuf = cp;
+
+  return i;
+}
+#endif /* ICONV_BLOCK_CONVERSION */
 #endif /* ICONV_TO_UCS_CES_TABLE */
 
 static int
@@ -264,7 +371,10 @@ _iconv_to_ucs_ces_handlers_table =
   NULL,
   NULL,
   NULL,
-  table_convert_to_ucs
+  table_convert_to_ucs,
+#ifdef ICONV_BLOCK_CONVERSION
+  table_convert_to_ucs_block
+#endif
 };
 #endif /* ICONV_FROM_UCS_CES_TABLE */
 
@@ -278,7 +388,10 @@ _iconv_from_ucs_ces_handlers_table =
   NULL,
   NULL,
   NULL,
-  table_convert_from_ucs
+  table_convert_from_ucs,
+#ifdef ICONV_BLOCK_CONVERSION
+  table_convert_from_ucs_block
+#endif
 };
 #endif /* ICONV_TO_UCS_CES_TABLE */
 
@@ -100,6 +100,43 @@ ucs_4_convert_from_ucs (void *data,
 
   return sizeof (ucs4_t);
 }
+
+#ifdef ICONV_BLOCK_CONVERSION
+static size_t
+ucs_4_convert_from_ucs_block (void *data,
+                                     const ucs4_t *in,
+                                     size_t n,
+                                     unsigned char **outbuf,
+                                     size_t *outbytesleft)
+{
+  unsigned char *cp = *outbuf;
+  int shift = *((int *)data) == UCS_4_BIG_ENDIAN ? 24 : 0;
+  ucs4_t c;
+  size_t i;
+
+  if (n > *outbytesleft / sizeof (ucs4_t))
+    n = *outbytesleft / sizeof (ucs4_t);
+
+  for (i = 0; i < n; i++)
+    {
+      c = in[i];
+      if ((c >= 0x0000D800 && c <= 0x0000DFFF)
+          || c > 0x7FFFFFFF || c == 0x0000FFFF || c == 0x0000FFFE)
+        break;
+      /* Store bytewise, the output buffer may be unaligned */
+      cp[0] = (unsigned char)(c >> shift);
+      cp[1] = (unsigned char)(c >> (shift ^ 8));
+      cp[2] = (unsigned char)(c >> (shift ^ 16));
+      cp[3] = (unsigned char)(c >> (shift ^ 24));
+      cp += sizeof (ucs4_t);
+    }
+
+  *outbuf = cp;
+  *outbytesleft -= i * sizeof (ucs4_t);
+
+  return i;
+}
+#endif /* ICONV_BLOCK_CONVERSION */
 #endif /* ICONV_FROM_UCS_CES_UCS_4 */
 
 #if defined (ICONV_TO_UCS_CES_UCS_4)
@@ -127,6 +164,42 @@ ucs_4_convert_to_ucs (void *data,
   
   return res;
 }
+
+#ifdef ICONV_BLOCK_CONVERSION
+static size_t
+ucs_4_convert_to_ucs_block (void *data,
+                                   const unsigned char **inbuf,
+                                   size_t *inbytesleft,
+                                   ucs4_t *out,
+                                   unsigned char *lens,
+                                   size_t n)
+{
+  const unsigned char *cp = *inbuf;
+  int shift = *((int *)data) == UCS_4_BIG_ENDIAN ? 24 : 0;
+  ucs4_t c;
+  size_t i;
+
+  if (n > *inbytesleft / sizeof (ucs4_t))
+    n = *inbytesleft / sizeof (ucs4_t);
+
+  for (i = 0; i < n; i++)
+    {
+      c = (ucs4_t)cp[0] << shift | (ucs4_t)cp[1] << (shift ^ 8)
+          | (ucs4_t)cp[2] << (shift ^ 16) | (ucs4_t)cp[3] << (shift ^ 24);
+      if ((c >= 0x0000D800 && c <= 0x0000DFFF)
+          || c > 0x7FFFFFFF || c == 0x0000FFFF || c == 0x0000FFFE)
+        break;
+      out[i] = c;
+      lens[i] = sizeof (ucs4_t);
+      cp += sizeof (ucs4_t);
+    }
+
+  *inbuf = cp;
+  *inbytesleft -= i * sizeof (ucs4_t);
+
+  return i;
+}
+#endif /* ICONV_BLOCK_CONVERSION */
 #endif /* ICONV_TO_UCS_CES_UCS_4 */
 
 static int
@@ -145,7 +218,10 @@ _iconv_to_ucs_ces_handlers_ucs_4 =
   NULL,
   NULL,
   NULL,
-  ucs_4_convert_to_ucs
+  ucs_4_convert_to_ucs,
+#ifdef ICONV_BLOCK_CONVERSION
+  ucs_4_convert_to_ucs_block
+#endif
 };
 #endif
 
@@ -159,7 +235,10 @@ _iconv_from_ucs_ces_handlers_ucs_4 =
   NULL,
   NULL,
   NULL,
-  ucs_4_convert_from_ucs
+  ucs_4_convert_from_ucs,
+#ifdef ICONV_BLOCK_CONVERSION
+  ucs_4_convert_from_ucs_block
+#endif
 };
 #endif
 
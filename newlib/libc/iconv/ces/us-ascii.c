@@ -55,6 +55,29 @@ us_ascii_convert_from_ucs (void *data,
 
   return 1;
 }
+
+#ifdef ICONV_BLOCK_CONVERSION
+static size_t
+us_ascii_convert_from_ucs_block (void *data,
+                                        const ucs4_t *in,
+                                        size_t n,
+                                        unsigned char **outbuf,
+                                        size_t *outbytesleft)
+{
+  size_t i;
+
+  if (n > *outbytesleft)
+    n = *outbytesleft;
+
+  for (i = 0; i < n && in[i] <= 0x7F; i++)
+    (*outbuf)[i] = (unsigned char)in[i];
+
+  *outbuf += i;
+  *outbytesleft -= i;
+
+  return i;
+}
+#endif /* ICONV_BLOCK_CONVERSION */
 #endif /* ICONV_FROM_UCS_CES_US_ASCII */
 
 #if defined (ICONV_TO_UCS_CES_US_ASCII)
@@ -78,6 +101,34 @@ us_ascii_convert_to_ucs (void *data,
 
   return res;
 }
+
+#ifdef ICONV_BLOCK_CONVERSION
+static size_t
+us_ascii_convert_to_ucs_block (void *data,
+                                      const unsigned char **inbuf,
+                                      size_t *inbytesleft,
+                                      ucs4_t *out,
+                                      unsigned char *lens,
+                                      size_t n)
+{
+  const unsigned char *in = *inbuf;
+  size_t i;
+
+  if (n > *inbytesleft)
+    n = *inbytesleft;
+
+  for (i = 0; i < n && in[i] <= 0x7F; i++)
+    {
+      out[i] = (ucs4_t)in[i];
+      lens[i] = 1;
+    }
+
+  *inbuf += i;
+  *inbytesleft -= i;
+
+  return i;
+}
+#endif /* ICONV_BLOCK_CONVERSION */
 #endif /* ICONV_TO_UCS_CES_US_ASCII */
 
 static int
@@ -96,7 +147,10 @@ _iconv_to_ucs_ces_handlers_us_ascii =
   NULL,
   NULL,
   NULL,
-  us_ascii_convert_to_ucs
+  us_ascii_convert_to_ucs,
+#ifdef ICONV_BLOCK_CONVERSION
+  us_ascii_convert_to_ucs_block
+#endif
 };
 #endif
 
@@ -110,7 +164,10 @@ _iconv_from_ucs_ces_handlers_us_ascii =
   NULL,
   NULL,
   NULL,
-  us_ascii_convert_from_ucs
+  us_ascii_convert_from_ucs,
+#ifdef ICONV_BLOCK_CONVERSION
+  us_ascii_convert_from_ucs_block
+#endif
 };
 #endif
 
@@ -50,6 +50,7 @@
 #define UTF16_LITTLE_ENDIAN 0x02
 #define UTF16_SYSTEM_ENDIAN 0x04
 #define UTF16_BOM_WRITTEN   0x08
+#define UTF16_DETECTED      0x10
 
 #define UTF16_BOM 0xFEFF
 
@@ -163,6 +164,83 @@ utf_16_convert_from_ucs (void *data,
 
   return bytes;
 }
+
+/*
+ * Only the initial state may be set; the next character written is
+ * preceded by the BOM again.
+ */
+static int
+utf_16_set_state_from_ucs (void *data,
+                                  mbstate_t *state)
+{
+  if (state->__count != 0)
+    return -1;
+
+  *((int *)data) &= ~UTF16_BOM_WRITTEN;
+  return 0;
+}
+
+#ifdef ICONV_BLOCK_CONVERSION
+static size_t
+utf_16_convert_from_ucs_block (void *data,
+                                      const ucs4_t *in,
+                                      size_t n,
+                                      unsigned char **outbuf,
+                                      size_t *outbytesleft)
+{
+  unsigned char *cp = *outbuf;
+  size_t left = *outbytesleft;
+  int state = *((int *)data);
+  int shift;
+  ucs4_t c;
+  ucs2_t w[2];
+  size_t i, j, words;
+
+  /* The BOM is written by utf_16_convert_from_ucs */
+  if (state == UTF16_BIG_ENDIAN)
+    shift = 8;
+  else if (state == UTF16_LITTLE_ENDIAN)
+    shift = 0;
+  else if (state == (UTF16_SYSTEM_ENDIAN | UTF16_BOM_WRITTEN))
+    shift = ICONV_HTOBES (1) == 1 ? 8 : 0;
+  else
+    return 0;
+
+  for (i = 0; i < n; i++)
+    {
+      c = in[i];
+      if (c > 0x0010FFFF || (c >= 0x0000D800 && c <= 0x0000DFFF)
+          || c == 0x0000FFFF || c == 0x0000FFFE)
+        break;
+      if (c < 0x00010000)
+        {
+          w[0] = (ucs2_t)c;
+          words = 1;
+        }
+      else
+        {
+          c -= 0x00010000;
+          w[0] = ((ucs2_t)(c >> 10) & 0x03FF) | 0xD800;
+          w[1] = (ucs2_t)(c & 0x000003FF) | 0xDC00;
+          words = 2;
+        }
+      if (left < words * sizeof (ucs2_t))
+        break;
+      /* Store bytewise, the output buffer may be unaligned */
+      for (j = 0; j < words; j++)
+        {
+          *cp++ = (unsigned char)(w[j] >> shift);
+          *cp++ = (unsigned char)(w[j] >> (shift ^ 8));
+        }
+      left -= words * sizeof (ucs2_t);
+    }
+
+  *outbuf = cp;
+  *outbytesleft = left;
+
+  return i;
+}
+#endif /* ICONV_BLOCK_CONVERSION */
 #endif /* ICONV_FROM_UCS_CES_UTF_16 */
 
 #if defined (ICONV_TO_UCS_CES_UTF_16)
@@ -206,9 +284,9 @@ utf_16_convert_to_ucs (void *data,
   if (*state == UTF16_UNDEFINED)
     {
       if (*cp == ICONV_HTOLES(UTF16_BOM))
-        *state = UTF16_LITTLE_ENDIAN;
+        *state = UTF16_LITTLE_ENDIAN | UTF16_DETECTED;
       else
-        *state = UTF16_BIG_ENDIAN;
+        *state = UTF16_BIG_ENDIAN | UTF16_DETECTED;
 
      if (   *cp == ICONV_HTOBES (UTF16_BOM)
          || *cp == ICONV_HTOLES (UTF16_BOM))
@@ -219,7 +297,7 @@ utf_16_convert_to_ucs (void *data,
        }
     }
     
-  if (*state == UTF16_LITTLE_ENDIAN)      
+  if (*state & UTF16_LITTLE_ENDIAN)
     w1 = ICONV_LETOHS (*cp);
   else
     w1 = ICONV_BETOHS (*cp);
@@ -242,7 +320,7 @@ utf_16_convert_to_ucs (void *data,
         
       cp += 1;
 
-      if (*state == UTF16_LITTLE_ENDIAN)      
+      if (*state & UTF16_LITTLE_ENDIAN)
         w2 = ICONV_LETOHS (*cp);
       else
         w2 = ICONV_BETOHS (*cp);
@@ -260,6 +338,82 @@ utf_16_convert_to_ucs (void *data,
   
   return res;
 }
+
+/*
+ * Only the initial state may be set; the byte order is taken from the
+ * input again unless it is given by the encoding name.
+ */
+static int
+utf_16_set_state_to_ucs (void *data,
+                                mbstate_t *state)
+{
+  if (state->__count != 0)
+    return -1;
+
+  if (*((int *)data) & UTF16_DETECTED)
+    *((int *)data) = UTF16_UNDEFINED;
+  return 0;
+}
+
+#ifdef ICONV_BLOCK_CONVERSION
+static size_t
+utf_16_convert_to_ucs_block (void *data,
+                                    const unsigned char **inbuf,
+                                    size_t *inbytesleft,
+                                    ucs4_t *out,
+                                    unsigned char *lens,
+                                    size_t n)
+{
+  const unsigned char *cp = *inbuf;
+  size_t left = *inbytesleft;
+  int state = *((int *)data);
+  int shift;
+  ucs2_t w1, w2;
+  size_t i;
+
+  /* The BOM is interpreted by utf_16_convert_to_ucs */
+  if (state & UTF16_BIG_ENDIAN)
+    shift = 8;
+  else if (state & UTF16_LITTLE_ENDIAN)
+    shift = 0;
+  else
+    return 0;
+
+#define UTF16_WORD(p) ((ucs2_t)((p)[0] << shift | (p)[1] << (shift ^ 8)))
+
+  for (i = 0; i < n && left >= sizeof (ucs2_t); i++)
+    {
+      w1 = UTF16_WORD (cp);
+      if (w1 < 0xD800 || w1 > 0xDFFF)
+        {
+          if (w1 == 0xFFFF || w1 == 0xFFFE)
+            break;
+          out[i] = (ucs4_t)w1;
+          lens[i] = sizeof (ucs2_t);
+        }
+      else
+        {
+          if (left < 2 * sizeof (ucs2_t) || w1 > 0xDBFF)
+            break;
+          w2 = UTF16_WORD (cp + sizeof (ucs2_t));
+          if (w2 < 0xDC00 || w2 > 0xDFFF)
+            break;
+          out[i] = ((ucs4_t)(w2 & 0x03FF) | ((ucs4_t)(w1 & 0x03FF) << 10))
+                   + 0x00010000;
+          lens[i] = 2 * sizeof (ucs2_t);
+        }
+      cp += lens[i];
+      left -= lens[i];
+    }
+
+#undef UTF16_WORD
+
+  *inbuf = cp;
+  *inbytesleft = left;
+
+  return i;
+}
+#endif /* ICONV_BLOCK_CONVERSION */
 #endif /* ICONV_TO_UCS_CES_UTF_16 */
 
 static int
@@ -276,9 +430,12 @@ _iconv_to_ucs_ces_handlers_utf_16 =
   utf_16_close,
   utf_16_get_mb_cur_max,
   NULL,
+  utf_16_set_state_to_ucs,
   NULL,
-  NULL,
-  utf_16_convert_to_ucs
+  utf_16_convert_to_ucs,
+#ifdef ICONV_BLOCK_CONVERSION
+  utf_16_convert_to_ucs_block
+#endif
 };
 #endif
 
@@ -290,9 +447,12 @@ _iconv_from_ucs_ces_handlers_utf_16 =
   utf_16_close,
   utf_16_get_mb_cur_max,
   NULL,
+  utf_16_set_state_from_ucs,
   NULL,
-  NULL,
-  utf_16_convert_from_ucs
+  utf_16_convert_from_ucs,
+#ifdef ICONV_BLOCK_CONVERSION
+  utf_16_convert_from_ucs_block
+#endif
 };
 #endif
 
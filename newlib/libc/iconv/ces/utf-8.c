@@ -120,6 +120,66 @@ convert_from_ucs (void *data,
   
   return bytes;
 }
+
+#ifdef ICONV_BLOCK_CONVERSION
+static size_t
+convert_from_ucs_block (void *data,
+                               const ucs4_t *in,
+                               size_t n,
+                               unsigned char **outbuf,
+                               size_t *outbytesleft)
+{
+  register unsigned char *cp = *outbuf;
+  register size_t left = *outbytesleft;
+  register ucs4_t c;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      c = in[i];
+      if (c < 0x80)
+        {
+          if (left < 1)
+            break;
+          *cp++ = (unsigned char)c;
+          left -= 1;
+        }
+      else if (c < 0x800)
+        {
+          if (left < 2)
+            break;
+          *cp++ = (unsigned char)((c >> 6) | 0xC0);
+          *cp++ = (unsigned char)((c & 0x3F) | 0x80);
+          left -= 2;
+        }
+      else if (c < 0x10000)
+        {
+          if (left < 3 || (c >= 0xD800 && c <= 0xDFFF) || c >= 0xFFFE)
+            break;
+          *cp++ = (unsigned char)((c >> 12) | 0xE0);
+          *cp++ = (unsigned char)(((c >> 6) & 0x3F) | 0x80);
+          *cp++ = (unsigned char)((c & 0x3F) | 0x80);
+          left -= 3;
+        }
+      else
+        {
+          /* Leave 5 and 6 byte sequences to convert_from_ucs */
+          if (left < 4 || c >= 0x200000)
+            break;
+          *cp++ = (unsigned char)((c >> 18) | 0xF0);
+          *cp++ = (unsigned char)(((c >> 12) & 0x3F) | 0x80);
+          *cp++ = (unsigned char)(((c >> 6) & 0x3F) | 0x80);
+          *cp++ = (unsigned char)((c & 0x3F) | 0x80);
+          left -= 4;
+        }
+    }
+
+  *outbuf = cp;
+  *outbytesleft = left;
+
+  return i;
+}
+#endif /* ICONV_BLOCK_CONVERSION */
 #endif /* ICONV_FROM_UCS_CES_UTF_8 */
 
 #if defined (ICONV_TO_UCS_CES_UTF_8)
@@ -254,6 +314,96 @@ convert_to_ucs (void *data,
 
   return res;
 }
+
+#ifdef ICONV_BLOCK_CONVERSION
+/* Nonzero if any byte of X has its high bit set */
+#define HAS_NON_ASCII(X) ((X) & (~0UL / 0xFF * 0x80))
+
+static size_t
+convert_to_ucs_block (void *data,
+                             const unsigned char **inbuf,
+                             size_t *inbytesleft,
+                             ucs4_t *out,
+                             unsigned char *lens,
+                             size_t n)
+{
+  register const unsigned char *in = *inbuf;
+  register size_t left = *inbytesleft;
+  register ucs4_t res;
+  size_t i = 0, j;
+
+  while (i < n && left > 0)
+    {
+      /* Widen ASCII a word at a time */
+      while (n - i >= sizeof (unsigned long)
+             && left >= sizeof (unsigned long)
+             && ((size_t)in & (sizeof (unsigned long) - 1)) == 0
+             && !HAS_NON_ASCII (*(const unsigned long *)in))
+        {
+          for (j = 0; j < sizeof (unsigned long); j++)
+            {
+              out[i] = in[j];
+              lens[i++] = 1;
+            }
+          in += sizeof (unsigned long);
+          left -= sizeof (unsigned long);
+        }
+      if (i == n || left == 0)
+        break;
+
+      /* Leave invalid, truncated, 5 and 6 byte sequences to convert_to_ucs */
+      if (in[0] < 0x80)
+        {
+          res = in[0];
+          lens[i] = 1;
+        }
+      else if (in[0] >= 0xC2 && in[0] < 0xE0)
+        {
+          if (left < 2 || (in[1] & 0xC0) != 0x80)
+            break;
+          res = ((ucs4_t)(in[0] & 0x1F) << 6) | (ucs4_t)(in[1] & 0x3F);
+          lens[i] = 2;
+        }
+      else if (in[0] >= 0xE0 && in[0] < 0xF0)
+        {
+          if (left < 3 || (in[1] & 0xC0) != 0x80 || (in[2] & 0xC0) != 0x80)
+            break;
+          res = ((ucs4_t)(in[0] & 0x0F) << 12)
+              | ((ucs4_t)(in[1] & 0x3F) << 6)
+              | ((ucs4_t)(in[2] & 0x3F));
+          if (res < 0x800 || (res >= 0xD800 && res <= 0xDFFF)
+              || res >= 0xFFFE)
+            break;
+          lens[i] = 3;
+        }
+      else if (in[0] >= 0xF0 && in[0] < 0xF8)
+        {
+          if (left < 4 || (in[1] & 0xC0) != 0x80 || (in[2] & 0xC0) != 0x80
+              || (in[3] & 0xC0) != 0x80)
+            break;
+          res = ((ucs4_t)(in[0] & 0x07) << 18)
+              | ((ucs4_t)(in[1] & 0x3F) << 12)
+              | ((ucs4_t)(in[2] & 0x3F) << 6)
+              | ((ucs4_t)(in[3] & 0x3F));
+          if (res < 0x10000)
+            break;
+          lens[i] = 4;
+        }
+      else
+        break;
+
+      out[i] = res;
+      in += lens[i];
+      left -= lens[i];
+      i++;
+    }
+
+  *inbuf = in;
+  *inbytesleft = left;
+
+  return i;
+}
+#endif /* ICONV_BLOCK_CONVERSION */
 #endif /* ICONV_TO_UCS_CES_UTF_8 */
 
 static int
@@ -272,7 +422,10 @@ _iconv_to_ucs_ces_handlers_utf_8 =
   NULL,
   NULL,
   NULL,
-  convert_to_ucs
+  convert_to_ucs,
+#ifdef ICONV_BLOCK_CONVERSION
+  convert_to_ucs_block
+#endif
 };
 #endif
 
@@ -286,7 +439,10 @@ _iconv_from_ucs_ces_handlers_utf_8 =
   NULL,
   NULL,
   NULL,
-  convert_from_ucs
+  convert_from_ucs,
+#ifdef ICONV_BLOCK_CONVERSION
+  convert_from_ucs_block
+#endif
 };
 #endif
 
@@ -3,6 +3,7 @@
  */
 
 #include <_ansi.h>
+#include "local.h"
 #include "encnames.h"
 
 const char
@@ -210,3 +211,378 @@ _iconv_aliases[] =
 #endif
   ""
 };
+
+#ifdef ICONV_ALIASES_HASH
+const unsigned char
+_iconv_aliases_disp[ICONV_ALIASES_HASH_BUCKETS] =
+{
+  3, 6, 8, 10, 10, 4, 2, 0, 14, 0, 6, 0, 31, 25, 0, 0,
+  0, 2, 1, 10, 4, 5, 3, 0, 1, 0, 9, 9, 49, 79, 0, 5,
+  0, 1, 42, 0, 28, 2, 1, 2, 64, 14, 24, 10, 0, 3, 5, 3,
+  2, 23, 7, 0, 0, 24, 24, 6, 0, 0, 0, 7, 15, 59, 28, 0,
+};
+
+const iconv_alias_t
+_iconv_aliases_hash[1 << ICONV_ALIASES_HASH_BITS] =
+{
+#if defined (_ICONV_FROM_ENCODING_BIG5) \
+ || defined (_ICONV_TO_ENCODING_BIG5)
+  [63] = {ICONV_ENCODING_BIG5, 63},
+  [33] = {"csbig5", 63},
+  [160] = {"big_five", 63},
+  [225] = {"bigfive", 63},
+  [174] = {"cn_big5", 63},
+  [74] = {"cp950", 63},
+#endif
+#if defined (_ICONV_FROM_ENCODING_CP775) \
+ || defined (_ICONV_TO_ENCODING_CP775)
+  [0] = {ICONV_ENCODING_CP775, 0},
+  [26] = {"ibm775", 0},
+  [202] = {"cspc775baltic", 0},
+#endif
+#if defined (_ICONV_FROM_ENCODING_CP850) \
+ || defined (_ICONV_TO_ENCODING_CP850)
+  [107] = {ICONV_ENCODING_CP850, 107},
+  [111] = {"ibm850", 107},
+  [40] = {"850", 107},
+  [232] = {"cspc850multilingual", 107},
+#endif
+#if defined (_ICONV_FROM_ENCODING_CP852) \
+ || defined (_ICONV_TO_ENCODING_CP852)
+  [123] = {ICONV_ENCODING_CP852, 123},
+  [176] = {"ibm852", 123},
+  [68] = {"852", 123},
+  [54] = {"cspcp852", 123},
+#endif
+#if defined (_ICONV_FROM_ENCODING_CP855) \
+ || defined (_ICONV_TO_ENCODING_CP855)
+  [11] = {ICONV_ENCODING_CP855, 11},
+  [24] = {"ibm855", 11},
+  [98] = {"855", 11},
+  [186] = {"csibm855", 11},
+#endif
+#if defined (_ICONV_FROM_ENCODING_CP866) \
+ || defined (_ICONV_TO_ENCODING_CP866)
+  [151] = {ICONV_ENCODING_CP866, 151},
+  [226] = {"866", 151},
+#endif
+#if defined (_ICONV_FROM_ENCODING_EUC_JP) \
+ || defined (_ICONV_TO_ENCODING_EUC_JP)
+  [119] = {ICONV_ENCODING_EUC_JP, 119},
+  [162] = {"eucjp", 119},
+#endif
+#if defined (_ICONV_FROM_ENCODING_EUC_KR) \
+ || defined (_ICONV_TO_ENCODING_EUC_KR)
+  [188] = {ICONV_ENCODING_EUC_KR, 188},
+  [25] = {"euckr", 188},
+#endif
+#if defined (_ICONV_FROM_ENCODING_EUC_TW) \
+ || defined (_ICONV_TO_ENCODING_EUC_TW)
+  [99] = {ICONV_ENCODING_EUC_TW, 99},
+  [102] = {"euctw", 99},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_1) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_1)
+  [173] = {ICONV_ENCODING_ISO_8859_1, 173},
+  [218] = {"iso8859_1", 173},
+  [103] = {"iso88591", 173},
+  [229] = {"iso_8859_1:1987", 173},
+  [127] = {"iso_ir_100", 173},
+  [109] = {"latin1", 173},
+  [216] = {"l1", 173},
+  [245] = {"ibm819", 173},
+  [136] = {"cp819", 173},
+  [43] = {"csisolatin1", 173},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_10) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_10)
+  [84] = {ICONV_ENCODING_ISO_8859_10, 84},
+  [30] = {"iso_8859_10:1992", 84},
+  [57] = {"iso_ir_157", 84},
+  [86] = {"iso885910", 84},
+  [19] = {"latin6", 84},
+  [121] = {"l6", 84},
+  [195] = {"csisolatin6", 84},
+  [61] = {"iso8859_10", 84},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_11) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_11)
+  [46] = {ICONV_ENCODING_ISO_8859_11, 46},
+  [115] = {"iso8859_11", 46},
+  [171] = {"iso885911", 46},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_13) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_13)
+  [39] = {ICONV_ENCODING_ISO_8859_13, 39},
+  [184] = {"iso_8859_13:1998", 39},
+  [64] = {"iso8859_13", 39},
+  [83] = {"iso885913", 39},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_14) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_14)
+  [200] = {ICONV_ENCODING_ISO_8859_14, 200},
+  [31] = {"iso_8859_14:1998", 200},
+  [196] = {"iso885914", 200},
+  [244] = {"iso8859_14", 200},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_15) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_15)
+  [147] = {ICONV_ENCODING_ISO_8859_15, 147},
+  [247] = {"iso885915", 147},
+  [205] = {"iso_8859_15:1998", 147},
+  [254] = {"iso8859_15", 147},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_2) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_2)
+  [12] = {ICONV_ENCODING_ISO_8859_2, 12},
+  [71] = {"iso8859_2", 12},
+  [59] = {"iso88592", 12},
+  [73] = {"iso_8859_2:1987", 12},
+  [60] = {"iso_ir_101", 12},
+  [135] = {"latin2", 12},
+  [4] = {"l2", 12},
+  [122] = {"csisolatin2", 12},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_3) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_3)
+  [66] = {ICONV_ENCODING_ISO_8859_3, 66},
+  [192] = {"iso_8859_3:1988", 66},
+  [47] = {"iso_ir_109", 66},
+  [190] = {"iso8859_3", 66},
+  [179] = {"latin3", 66},
+  [223] = {"l3", 66},
+  [131] = {"csisolatin3", 66},
+  [14] = {"iso88593", 66},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_4) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_4)
+  [92] = {ICONV_ENCODING_ISO_8859_4, 92},
+  [215] = {"iso8859_4", 92},
+  [166] = {"iso88594", 92},
+  [159] = {"iso_8859_4:1988", 92},
+  [72] = {"iso_ir_110", 92},
+  [182] = {"latin4", 92},
+  [70] = {"l4", 92},
+  [129] = {"csisolatin4", 92},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_5) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_5)
+  [155] = {ICONV_ENCODING_ISO_8859_5, 155},
+  [124] = {"iso8859_5", 155},
+  [220] = {"iso88595", 155},
+  [53] = {"iso_8859_5:1988", 155},
+  [41] = {"iso_ir_144", 155},
+  [56] = {"cyrillic", 155},
+  [241] = {"csisolatincyrillic", 155},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_6) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_6)
+  [97] = {ICONV_ENCODING_ISO_8859_6, 97},
+  [206] = {"iso_8859_6:1987", 97},
+  [158] = {"iso_ir_127", 97},
+  [248] = {"iso8859_6", 97},
+  [230] = {"ecma_114", 97},
+  [187] = {"asmo_708", 97},
+  [164] = {"arabic", 97},
+  [28] = {"csisolatinarabic", 97},
+  [101] = {"iso88596", 97},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_7) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_7)
+  [243] = {ICONV_ENCODING_ISO_8859_7, 243},
+  [170] = {"iso_8859_7:1987", 243},
+  [104] = {"iso_ir_126", 243},
+  [36] = {"iso8859_7", 243},
+  [18] = {"elot_928", 243},
+  [113] = {"ecma_118", 243},
+  [209] = {"greek", 243},
+  [214] = {"greek8", 243},
+  [95] = {"csisolatingreek", 243},
+  [169] = {"iso88597", 243},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_8) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_8)
+  [37] = {ICONV_ENCODING_ISO_8859_8, 37},
+  [77] = {"iso_8859_8:1988", 37},
+  [137] = {"iso_ir_138", 37},
+  [198] = {"iso8859_8", 37},
+  [242] = {"hebrew", 37},
+  [114] = {"csisolatinhebrew", 37},
+  [34] = {"iso88598", 37},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_9) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_9)
+  [249] = {ICONV_ENCODING_ISO_8859_9, 249},
+  [210] = {"iso_8859_9:1989", 249},
+  [165] = {"iso_ir_148", 249},
+  [126] = {"iso8859_9", 249},
+  [16] = {"latin5", 249},
+  [2] = {"l5", 249},
+  [197] = {"csisolatin5", 249},
+  [88] = {"iso88599", 249},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_IR_111) \
+ || defined (_ICONV_TO_ENCODING_ISO_IR_111)
+  [116] = {ICONV_ENCODING_ISO_IR_111, 116},
+  [112] = {"ecma_cyrillic", 116},
+  [62] = {"koi8_e", 116},
+  [38] = {"koi8e", 116},
+  [1] = {"csiso111ecmacyrillic", 116},
+#endif
+#if defined (_ICONV_FROM_ENCODING_KOI8_R) \
+ || defined (_ICONV_TO_ENCODING_KOI8_R)
+  [42] = {ICONV_ENCODING_KOI8_R, 42},
+  [17] = {"cskoi8r", 42},
+  [234] = {"koi8r", 42},
+  [156] = {"koi8", 42},
+#endif
+#if defined (_ICONV_FROM_ENCODING_KOI8_RU) \
+ || defined (_ICONV_TO_ENCODING_KOI8_RU)
+  [78] = {ICONV_ENCODING_KOI8_RU, 78},
+  [44] = {"koi8ru", 78},
+#endif
+#if defined (_ICONV_FROM_ENCODING_KOI8_U) \
+ || defined (_ICONV_TO_ENCODING_KOI8_U)
+  [69] = {ICONV_ENCODING_KOI8_U, 69},
+  [82] = {"koi8u", 69},
+#endif
+#if defined (_ICONV_FROM_ENCODING_KOI8_UNI) \
+ || defined (_ICONV_TO_ENCODING_KOI8_UNI)
+  [50] = {ICONV_ENCODING_KOI8_UNI, 50},
+  [240] = {"koi8uni", 50},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_2) \
+ || defined (_ICONV_TO_ENCODING_UCS_2)
+  [163] = {ICONV_ENCODING_UCS_2, 163},
+  [235] = {"ucs2", 163},
+  [238] = {"iso_10646_ucs_2", 163},
+  [8] = {"iso10646_ucs_2", 163},
+  [255] = {"iso_10646_ucs2", 163},
+  [149] = {"iso10646_ucs2", 163},
+  [10] = {"iso10646ucs2", 163},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_2_INTERNAL) \
+ || defined (_ICONV_TO_ENCODING_UCS_2_INTERNAL)
+  [175] = {ICONV_ENCODING_UCS_2_INTERNAL, 175},
+  [231] = {"ucs2_internal", 175},
+  [253] = {"ucs_2internal", 175},
+  [193] = {"ucs2internal", 175},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_2BE) \
+ || defined (_ICONV_TO_ENCODING_UCS_2BE)
+  [93] = {ICONV_ENCODING_UCS_2BE, 93},
+  [201] = {"ucs2be", 93},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_2LE) \
+ || defined (_ICONV_TO_ENCODING_UCS_2LE)
+  [172] = {ICONV_ENCODING_UCS_2LE, 172},
+  [105] = {"ucs2le", 172},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_4) \
+ || defined (_ICONV_TO_ENCODING_UCS_4)
+  [252] = {ICONV_ENCODING_UCS_4, 252},
+  [128] = {"ucs4", 252},
+  [141] = {"iso_10646_ucs_4", 252},
+  [183] = {"iso10646_ucs_4", 252},
+  [91] = {"iso_10646_ucs4", 252},
+  [5] = {"iso10646_ucs4", 252},
+  [154] = {"iso10646ucs4", 252},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_4_INTERNAL) \
+ || defined (_ICONV_TO_ENCODING_UCS_4_INTERNAL)
+  [144] = {ICONV_ENCODING_UCS_4_INTERNAL, 144},
+  [185] = {"ucs4_internal", 144},
+  [152] = {"ucs_4internal", 144},
+  [251] = {"ucs4internal", 144},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_4BE) \
+ || defined (_ICONV_TO_ENCODING_UCS_4BE)
+  [67] = {ICONV_ENCODING_UCS_4BE, 67},
+  [65] = {"ucs4be", 67},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_4LE) \
+ || defined (_ICONV_TO_ENCODING_UCS_4LE)
+  [9] = {ICONV_ENCODING_UCS_4LE, 9},
+  [132] = {"ucs4le", 9},
+#endif
+#if defined (_ICONV_FROM_ENCODING_US_ASCII) \
+ || defined (_ICONV_TO_ENCODING_US_ASCII)
+  [181] = {ICONV_ENCODING_US_ASCII, 181},
+  [178] = {"ansi_x3.4_1968", 181},
+  [219] = {"ansi_x3.4_1986", 181},
+  [79] = {"iso_646.irv:1991", 181},
+  [106] = {"ascii", 181},
+  [21] = {"iso646_us", 181},
+  [49] = {"us", 181},
+  [20] = {"ibm367", 181},
+  [222] = {"cp367", 181},
+  [139] = {"csascii", 181},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UTF_16) \
+ || defined (_ICONV_TO_ENCODING_UTF_16)
+  [85] = {ICONV_ENCODING_UTF_16, 85},
+  [148] = {"utf16", 85},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UTF_16BE) \
+ || defined (_ICONV_TO_ENCODING_UTF_16BE)
+  [120] = {ICONV_ENCODING_UTF_16BE, 120},
+  [140] = {"utf16be", 120},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UTF_16LE) \
+ || defined (_ICONV_TO_ENCODING_UTF_16LE)
+  [52] = {ICONV_ENCODING_UTF_16LE, 52},
+  [89] = {"utf16le", 52},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UTF_8) \
+ || defined (_ICONV_TO_ENCODING_UTF_8)
+  [76] = {ICONV_ENCODING_UTF_8, 76},
+  [15] = {"utf8", 76},
+#endif
+#if defined (_ICONV_FROM_ENCODING_WIN_1250) \
+ || defined (_ICONV_TO_ENCODING_WIN_1250)
+  [246] = {ICONV_ENCODING_WIN_1250, 246},
+  [213] = {"cp1250", 246},
+#endif
+#if defined (_ICONV_FROM_ENCODING_WIN_1251) \
+ || defined (_ICONV_TO_ENCODING_WIN_1251)
+  [239] = {ICONV_ENCODING_WIN_1251, 239},
+  [48] = {"cp1251", 239},
+#endif
+#if defined (_ICONV_FROM_ENCODING_WIN_1252) \
+ || defined (_ICONV_TO_ENCODING_WIN_1252)
+  [233] = {ICONV_ENCODING_WIN_1252, 233},
+  [125] = {"cp1252", 233},
+#endif
+#if defined (_ICONV_FROM_ENCODING_WIN_1253) \
+ || defined (_ICONV_TO_ENCODING_WIN_1253)
+  [203] = {ICONV_ENCODING_WIN_1253, 203},
+  [81] = {"cp1253", 203},
+#endif
+#if defined (_ICONV_FROM_ENCODING_WIN_1254) \
+ || defined (_ICONV_TO_ENCODING_WIN_1254)
+  [227] = {ICONV_ENCODING_WIN_1254, 227},
+  [51] = {"cp1254", 227},
+#endif
+#if defined (_ICONV_FROM_ENCODING_WIN_1255) \
+ || defined (_ICONV_TO_ENCODING_WIN_1255)
+  [108] = {ICONV_ENCODING_WIN_1255, 108},
+  [211] = {"cp1255", 108},
+#endif
+#if defined (_ICONV_FROM_ENCODING_WIN_1256) \
+ || defined (_ICONV_TO_ENCODING_WIN_1256)
+  [237] = {ICONV_ENCODING_WIN_1256, 237},
+  [23] = {"cp1256", 237},
+#endif
+#if defined (_ICONV_FROM_ENCODING_WIN_1257) \
+ || defined (_ICONV_TO_ENCODING_WIN_1257)
+  [146] = {ICONV_ENCODING_WIN_1257, 146},
+  [161] = {"cp1257", 146},
+#endif
+#if defined (_ICONV_FROM_ENCODING_WIN_1258) \
+ || defined (_ICONV_TO_ENCODING_WIN_1258)
+  [96] = {ICONV_ENCODING_WIN_1258, 96},
+  [191] = {"cp1258", 96},
+#endif
+};
+#endif /* ICONV_ALIASES_HASH */
+
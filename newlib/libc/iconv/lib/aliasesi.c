@@ -33,6 +33,7 @@
 #include <sys/iconvnls.h>
 #include "local.h"
 
+#ifndef ICONV_ALIASES_HASH
 /*
  * canonical_form - canonize 'str'.
  *
@@ -119,9 +120,10 @@ search_again:
       goto search_again;
     }
 
-  while(--p > table && *p != '\n');
+  while (p > table && *(p-1) != '\n')
+    p--;
 
-  if (*(++p) == '#')
+  if (*p == '#')
     return NULL;
 
   for (end = p + 1; !isspace (*end) && *end != '\n' && *end != '\0'; end++);
@@ -129,6 +131,48 @@ search_again:
   return _strndup_r (rptr, p, (size_t)(end - p));
 }
 
+#else /* ICONV_ALIASES_HASH */
+
+/*
+ * _iconv_find_encoding_name - find built-in encoding name by given alias.
+ *
+ * PARAMETERS:
+ *   const char *ca - encoding alias to resolve.
+ *
+ * DESCRIPTION:
+ *   Canonizes 'ca' as canonical_form() would and looks the result up in
+ *   the perfect hash generated by mkdeps.pl. Doesn't allocate memory.
+ *
+ * RETURN:
+ *   Pointer to the encoding name if found, NULL otherwise. The same
+ *   pointer is returned for all aliases of an encoding.
+ */
+const char *
+_iconv_find_encoding_name (const char *ca)
+{
+  char buf[ICONV_ALIAS_MAX];
+  __uint32_t h = 2166136261UL;
+  const iconv_alias_t *a;
+  int i;
+
+  for (i = 0; ca[i] != '\0'; i++)
+    {
+      if (i == ICONV_ALIAS_MAX - 1)
+        return NULL;
+      buf[i] = ca[i] == '-' ? '_' : tolower ((unsigned char)ca[i]);
+      h = (h ^ (unsigned char)buf[i]) * 16777619UL;
+    }
+  buf[i] = '\0';
+
+  a = &_iconv_aliases_hash[ICONV_ALIASES_HASH_SLOT (h,
+        _iconv_aliases_disp[h & (ICONV_ALIASES_HASH_BUCKETS - 1)])];
+  if (a->alias == NULL || strcmp (a->alias, buf) != 0)
+    return NULL;
+
+  return _iconv_aliases_hash[a->name].alias;
+}
+#endif /* ICONV_ALIASES_HASH */
+
 /*
  * _iconv_resolve_encoding_name - resolves encoding's name by given alias. 
  *
@@ -148,6 +192,12 @@ char *
 _iconv_resolve_encoding_name (struct _reent *rptr,
                                      const char *ca)
 {
+#ifdef ICONV_ALIASES_HASH
+  if ((ca = _iconv_find_encoding_name (ca)) == NULL)
+    return NULL;
+
+  return _strdup_r (rptr, ca);
+#else
   char *p = (char *)ca;
 
   /* Alias shouldn't contain white spaces, '\n' and '\r' symbols */ 
@@ -162,5 +212,6 @@ _iconv_resolve_encoding_name (struct _reent *rptr,
   
   _free_r (rptr, (void *)ca);
   return p;
+#endif
 }
 
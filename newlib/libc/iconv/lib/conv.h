@@ -30,6 +30,7 @@
 #include <reent.h>
 #include <sys/types.h>
 #include <wchar.h>
+#include "local.h"
 
 /* Bits for 'flags' parameter of 'convert' call */
 #define ICONV_DONT_SAVE_BIT 1
@@ -206,6 +207,15 @@ typedef struct
    * object if UCS-based conversion is used).
    */
   void *data;
+
+#ifdef ICONV_OPEN_CACHE
+  /*
+   * Encoding names as returned by _iconv_find_encoding_name(), the key of
+   * the descriptor in the cache of closed descriptors.
+   */
+  const char *to;
+  const char *from;
+#endif
 } iconv_conversion_t;
 
 
@@ -111,6 +111,7 @@ No supporting OS subroutine calls are required.
 #include <iconv.h>
 #include <wchar.h>
 #include <sys/iconvnls.h>
+#include <sys/lock.h>
 #include "local.h"
 #include "conv.h"
 #include "ucsconv.h"
@@ -147,6 +148,69 @@ iconv_close (iconv_t cd)
 
 
 #ifndef _REENT_ONLY
+#ifdef ICONV_OPEN_CACHE
+/*
+ * Descriptors released by iconv_close(), reset to the initial shift state
+ * and waiting to be handed out again by iconv_open() for the same pair of
+ * encodings.
+ */
+static iconv_conversion_t *iconv_cache[ICONV_OPEN_CACHE_SIZE];
+#ifndef __SINGLE_THREAD__
+__LOCK_INIT(static, __iconv_cache_mutex);
+#endif
+
+static iconv_conversion_t *
+iconv_cache_get (const char *to,
+                 const char *from)
+{
+  iconv_conversion_t *ic = NULL;
+  int i;
+
+#ifndef __SINGLE_THREAD__
+  __lock_acquire (__iconv_cache_mutex);
+#endif
+  for (i = 0; i < ICONV_OPEN_CACHE_SIZE; i++)
+    if (iconv_cache[i] != NULL
+        && iconv_cache[i]->to == to && iconv_cache[i]->from == from)
+      {
+        ic = iconv_cache[i];
+        iconv_cache[i] = NULL;
+        break;
+      }
+#ifndef __SINGLE_THREAD__
+  __lock_release (__iconv_cache_mutex);
+#endif
+
+  return ic;
+}
+
+static int
+iconv_cache_put (iconv_conversion_t *ic)
+{
+  mbstate_t state_null = ICONV_ZERO_MB_STATE_T;
+  int i;
+
+  if (ic->handlers->set_state (ic->data, &state_null, 0) != 0
+      || ic->handlers->set_state (ic->data, &state_null, 1) != 0)
+    return 0;
+
+#ifndef __SINGLE_THREAD__
+  __lock_acquire (__iconv_cache_mutex);
+#endif
+  for (i = 0; i < ICONV_OPEN_CACHE_SIZE; i++)
+    if (iconv_cache[i] == NULL)
+      {
+        iconv_cache[i] = ic;
+        break;
+      }
+#ifndef __SINGLE_THREAD__
+  __lock_release (__iconv_cache_mutex);
+#endif
+
+  return i < ICONV_OPEN_CACHE_SIZE;
+}
+#endif /* ICONV_OPEN_CACHE */
+
 iconv_t
 _iconv_open_r (struct _reent *rptr,
                       const char *to,
@@ -157,6 +221,14 @@ _iconv_open_r (struct _reent *rptr,
   if (to == NULL || from == NULL || *to == '\0' || *from == '\0')
     return (iconv_t)-1;
 
+#ifdef ICONV_OPEN_CACHE
+  if ((to = _iconv_find_encoding_name (to)) == NULL
+      || (from = _iconv_find_encoding_name (from)) == NULL)
+    return (iconv_t)-1;
+
+  if ((ic = iconv_cache_get (to, from)) != NULL)
+    return (void *)ic;
+#else
   if ((to = (const char *)_iconv_resolve_encoding_name (rptr, to)) == NULL)
     return (iconv_t)-1;
 
@@ -165,6 +237,7 @@ _iconv_open_r (struct _reent *rptr,
       _free_r (rptr, (void *)to);
       return (iconv_t)-1;
     }
+#endif
 
   ic = (iconv_conversion_t *)_malloc_r (rptr, sizeof (iconv_conversion_t));
   if (ic == NULL)
@@ -184,8 +257,13 @@ _iconv_open_r (struct _reent *rptr,
       ic->data = ic->handlers->open (rptr, to, from);
     }
 
+#ifdef ICONV_OPEN_CACHE
+  ic->to = to;
+  ic->from = from;
+#else
   _free_r (rptr, (void *)to);
   _free_r (rptr, (void *)from);
+#endif
 
   if (ic->data == NULL)
     {
@@ -298,6 +376,11 @@ _iconv_close_r (struct _reent *rptr,
       return -1;
     }
 
+#ifdef ICONV_OPEN_CACHE
+  if (iconv_cache_put (ic))
+    return 0;
+#endif
+
   res = (int)ic->handlers->close (rptr, ic->data);
   
   _free_r (rptr, (void *)cd);
@@ -60,5 +60,40 @@ typedef __uint32_t ucs4_t;
 /* The list of built-in encoding names and aliases */
 extern const char _iconv_aliases[];
 
+#if !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+/*
+ * The built-in names are also found through a perfect hash generated by
+ * mkdeps.pl. A name hashes into one of ICONV_ALIASES_HASH_BUCKETS buckets,
+ * and the bucket's displacement selects the slot in _iconv_aliases_hash.
+ * Descriptors closed by iconv_close are kept for reuse by iconv_open.
+ */
+#define ICONV_ALIASES_HASH
+#define ICONV_ALIASES_HASH_BUCKETS 64
+#define ICONV_ALIASES_HASH_BITS    8
+#define ICONV_ALIASES_HASH_SLOT(h, d) \
+  ((__uint32_t)(((h) ^ (d)) * 0x61C88647UL) >> (32 - ICONV_ALIASES_HASH_BITS))
+/* Longest built-in encoding name or alias, plus one */
+#define ICONV_ALIAS_MAX 32
+/* Retargeted ports supply a fixed set of static locks, so no cache there */
+#ifndef _RETARGETABLE_LOCKING
+#define ICONV_OPEN_CACHE
+#define ICONV_OPEN_CACHE_SIZE 8
+#endif
+
+typedef struct
+{
+  /* Normalized name or alias, NULL for an unused slot */
+  const char *alias;
+  /* Slot of the encoding's normalized name */
+  unsigned short name;
+} iconv_alias_t;
+
+extern const unsigned char _iconv_aliases_disp[];
+extern const iconv_alias_t _iconv_aliases_hash[];
+
+const char *
+_iconv_find_encoding_name (const char *ca);
+#endif
+
 #endif /* !__ICONV_LIB_LOCAL_H__ */
 
@@ -154,13 +154,60 @@ ucs_based_conversion_convert (struct _reent *rptr,
   unsigned char *poutbuf1;
   size_t res = 0;
   iconv_ucs_conversion_t *uc = (iconv_ucs_conversion_t *)data;
+#ifdef ICONV_BLOCK_CONVERSION
+  ucs4_t block[ICONV_BLOCK_LEN];
+  unsigned char lens[ICONV_BLOCK_LEN];
+  int use_block = !(flags & ICONV_DONT_SAVE_BIT)
+                  && uc->to_ucs.handlers->convert_to_ucs_block != NULL
+                  && uc->from_ucs.handlers->convert_from_ucs_block != NULL;
+#endif
 
   while (*inbytesleft > 0)
     {
       register size_t bytes;
       register ucs4_t ch;
-      const unsigned char *inbuf_save = *inbuf;
-      size_t inbyteslef_save = *inbytesleft;
+      const unsigned char *inbuf_save;
+      size_t inbyteslef_save;
+
+#ifdef ICONV_BLOCK_CONVERSION
+      /*
+       * Convert runs of characters both CES converters handle in bulk.
+       * The character the block handlers stop at, if any, goes through
+       * the per-character code below, which reports errors or writes
+       * the default character. If the output side stops early, step
+       * back in the input to the first character not written.
+       */
+      while (use_block && *inbytesleft > 0 && *outbytesleft > 0)
+        {
+          size_t n, done, i;
+
+          inbuf_save = *inbuf;
+          inbyteslef_save = *inbytesleft;
+          n = uc->to_ucs.handlers->convert_to_ucs_block (uc->to_ucs.data,
+                                                         inbuf, inbytesleft,
+                                                         block, lens,
+                                                         ICONV_BLOCK_LEN);
+          if (n == 0)
+            break;
+
+          done = uc->from_ucs.handlers->convert_from_ucs_block (
+                                         uc->from_ucs.data, block, n,
+                                         outbuf, outbytesleft);
+          if (done < n)
+            {
+              *inbuf = inbuf_save;
+              for (i = 0; i < done; i++)
+                *inbuf += lens[i];
+              *inbytesleft = inbyteslef_save - (*inbuf - inbuf_save);
+              break;
+            }
+        }
+      if (*inbytesleft == 0)
+        break;
+#endif
+
+      inbuf_save = *inbuf;
+      inbyteslef_save = *inbytesleft;
 
       if (*outbytesleft == 0)
         {
@@ -41,6 +41,18 @@
 /* All unknown characters are marked by this code */
 #define DEFAULT_CHARACTER 0x3f /* ASCII '?' */
 
+/*
+ * CES converters may provide block conversion handlers (see below) which
+ * convert runs of characters without a call per character. They are
+ * omitted when optimizing for size.
+ */
+#if !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+#  define ICONV_BLOCK_CONVERSION
+#endif
+
+/* Maximum number of characters passed between block conversion handlers */
+#define ICONV_BLOCK_LEN 64
+
 
 /*
  * iconv_to_ucs_ces_handlers_t - "to UCS" CES converter handlers.
@@ -158,6 +170,34 @@ typedef struct
   ucs4_t (*convert_to_ucs) (void *data,
                                  const unsigned char **inbuf,
                                  size_t *inbytesleft);
+
+  /*
+   * convert_to_ucs_block - convert a run of characters to UCS (optional).
+   *
+   * PARAMETERS:
+   *   void *data               - CES converter-specific data;
+   *   const unsigned char **inbuf - buffer with input characters byte sequence;
+   *   size_t *inbytesleft          - input buffer bytes count;
+   *   ucs4_t *out                  - output array of UCS codes;
+   *   unsigned char *lens          - output array of input sequence lengths;
+   *   size_t n                     - size of 'out' and 'lens' arrays.
+   *
+   * DESCRIPTION:
+   *   Converts up to 'n' input characters like convert_to_ucs does and stores
+   *   their codes in 'out' and the byte length of each input sequence in
+   *   'lens'. Stops in front of any character convert_to_ucs would reject
+   *   or which changes the converter state; convert_to_ucs is called for it.
+   *   May be NULL.
+   *
+   * RETURN:
+   *   Returns the number of characters converted.
+   */
+  size_t (*convert_to_ucs_block) (void *data,
+                                       const unsigned char **inbuf,
+                                       size_t *inbytesleft,
+                                       ucs4_t *out,
+                                       unsigned char *lens,
+                                       size_t n);
 } iconv_to_ucs_ces_handlers_t;
 
 
@@ -219,6 +259,32 @@ typedef struct
                                    ucs4_t in,
                                    unsigned char **outbuf,
                                    size_t *outbytesleft);
+
+  /*
+   * convert_from_ucs_block - convert a run of UCS characters (optional).
+   *
+   * PARAMETERS:
+   *   void *data         - CES converter-specific data;
+   *   const ucs4_t *in       - input UCS-4 characters;
+   *   size_t n               - number of input characters;
+   *   unsigned char **outbuf - output buffer for the result;
+   *   size_t *outbytesleft   - output buffer bytes count.
+   *
+   * DESCRIPTION:
+   *   Converts up to 'n' characters like convert_from_ucs does. Stops in
+   *   front of any character which has no correspondent character in
+   *   destination encoding, does not fit into the output buffer or
+   *   changes the converter state; convert_from_ucs is called for it.
+   *   May be NULL.
+   *
+   * RETURN:
+   *   Returns the number of characters converted.
+   */
+  size_t (*convert_from_ucs_block) (void *data,
+                                         const ucs4_t *in,
+                                         size_t n,
+                                         unsigned char **outbuf,
+                                         size_t *outbytesleft);
 } iconv_from_ucs_ces_handlers_t;
 
 
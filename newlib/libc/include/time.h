@@ -102,6 +102,10 @@ void      tzset 	(void);
 #endif
 void      _tzset_r 	(struct _reent *);
 
+#if __BSD_VISIBLE || __GNU_VISIBLE
+time_t    timegm 	(struct tm *);
+#endif
+
 /* getdate functions */
 
 #ifdef HAVE_GETDATE
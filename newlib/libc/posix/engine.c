@@ -53,6 +53,14 @@
 #define	print	sprint
 #define	at	sat
 #define	match	smat
+#define	dfasetup	sdfasetup
+#define	dfadone	sdfadone
+#define	dfatab	sdfatab
+#define	dfaintern	sdfaintern
+#define	dfanext	sdfanext
+#define	dfaflags	sdfaflags
+#define	dfast	sdfast
+#define	dslow	sdslow
 #endif
 #ifdef LNAMES
 #define	matcher	lmatcher
@@ -64,6 +72,14 @@
 #define	print	lprint
 #define	at	lat
 #define	match	lmat
+#define	dfasetup	ldfasetup
+#define	dfadone	ldfadone
+#define	dfatab	ldfatab
+#define	dfaintern	ldfaintern
+#define	dfanext	ldfanext
+#define	dfaflags	ldfaflags
+#define	dfast	ldfast
+#define	dslow	ldslow
 #endif
 
 /* another structure passed up and down to avoid zillions of parameters */
@@ -76,6 +92,8 @@ struct match {
 	char *endp;		/* end of string -- virtual NUL here */
 	char *coldp;		/* can be no match starting before here */
 	char **lastpos;		/* [nplus+1] */
+	struct re_dfa *dfa;	/* DFA cache, NULL if not in use */
+	struct re_dfatab *dt;	/* its tables this matcher holds */
 	STATEVARS;
 	states st;		/* current states */
 	states fresh;		/* states for a fresh start */
@@ -95,6 +113,16 @@ static char *backref(struct match *m, char *start, char *stop, sopno startst, so
 static char *fast(struct match *m, char *start, char *stop, sopno startst, sopno stopst);
 static char *slow(struct match *m, char *start, char *stop, sopno startst, sopno stopst);
 static states step(struct re_guts *g, sopno start, sopno stop, states bef, int ch, states aft);
+static struct re_dfa *dfasetup(struct match *m);
+static void dfadone(struct match *m);
+#ifdef REGEX_DFA
+static struct re_dfatab *dfatab(struct match *m, states st);
+static int dfaintern(struct match *m, struct re_dfatab *t, states st);
+static int dfanext(struct match *m, int ds, int col, int ch);
+static int dfaflags(struct match *m, int ds, int lastc, int c);
+static char *dfast(struct match *m, char *start, char *stop);
+static char *dslow(struct match *m, char *start, char *stop);
+#endif
 #define	BOL	(OUT+1)
 #define	EOL	(BOL+1)
 #define	BOLEOL	(BOL+2)
@@ -230,6 +258,7 @@ int eflags;
 	SETUP(m->tmp);
 	SETUP(m->empty);
 	CLEAR(m->empty);
+	m->dfa = dfasetup(m);
 
 	/* Adjust start according to moffset, to speed things up */
 	if (g->moffset > -1)
@@ -239,6 +268,7 @@ int eflags;
 	for (;;) {
 		endp = fast(m, start, stop, gf, gl);
 		if (endp == NULL) {		/* a miss */
+			dfadone(m);
 			STATETEARDOWN(m);
 			return(REG_NOMATCH);
 		}
@@ -263,6 +293,7 @@ int eflags;
 			m->pmatch = (regmatch_t *)malloc((m->g->nsub + 1) *
 							sizeof(regmatch_t));
 		if (m->pmatch == NULL) {
+			dfadone(m);
 			STATETEARDOWN(m);
 			return(REG_ESPACE);
 		}
@@ -277,6 +308,7 @@ int eflags;
 							sizeof(char *));
 			if (g->nplus > 0 && m->lastpos == NULL) {
 				free(m->pmatch);
+				dfadone(m);
 				STATETEARDOWN(m);
 				return(REG_ESPACE);
 			}
@@ -336,6 +368,7 @@ int eflags;
 		free((char *)m->pmatch);
 	if (m->lastpos != NULL)
 		free((char *)m->lastpos);
+	dfadone(m);
 	STATETEARDOWN(m);
 	return(0);
 }
@@ -761,6 +794,15 @@ sopno stopst;
 	int i;
 	char *coldp;		/* last p after which no match was underway */
 
+#ifdef REGEX_DFA
+	if (m->dfa != NULL && startst == m->g->firststate+1 &&
+					stopst == m->g->laststate) {
+		p = dfast(m, start, stop);
+		if (m->dfa != NULL)
+			return(p);
+	}
+#endif
+
 	CLEAR(st);
 	SET1(st, startst);
 	st = step(m->g, startst, stopst, st, NOTHING, st);
@@ -853,6 +895,15 @@ sopno stopst;
 	char *matchp;		/* last p at which a match ended */
 
 	AT("slow", start, stop, startst, stopst);
+#ifdef REGEX_DFA
+	if (m->dfa != NULL && startst == m->g->firststate+1 &&
+					stopst == m->g->laststate) {
+		p = dslow(m, start, stop);
+		if (m->dfa != NULL)
+			return(p);
+	}
+#endif
+
 	CLEAR(st);
 	SET1(st, startst);
 	SP("sstart", st, *p);
@@ -1044,6 +1095,434 @@ states aft;			/* states already known reachable after */
 	return(aft);
 }
 
+#ifdef REGEX_DFA
+/*
+ - dfasetup - get the DFA cache ready for use by this matcher
+ == static struct re_dfa *dfasetup(struct match *m);
+ *
+ * The tables are allocated the first time the RE is executed.  The
+ * matcher holds a reference to the tables it starts with, so they stay
+ * around even if another matcher replaces them meanwhile.
+ */
+static struct re_dfa *		/* NULL if the DFA cannot be used */
+dfasetup(m)
+struct match *m;
+{
+	struct re_guts *g = m->g;
+	struct re_dfa *d = g->dfa;
+
+	m->dt = NULL;
+	if (d == NULL)
+		return(NULL);
+	__lock_acquire(d->lock);
+	if (d->tab == NULL) {
+		d->ncols = 2*g->ncategories + DFA_NPSEUDO;
+		d->setsize = SETBYTES;
+		d->tab = dfatab(m, m->st);
+	}
+	if (d->tab == NULL || d->setsize != SETBYTES) {
+		/* no memory, or set up by the other state representation */
+		__lock_release(d->lock);
+		return(NULL);
+	}
+	m->dt = d->tab;
+	m->dt->refs++;
+	__lock_release(d->lock);
+	return(d);
+}
+
+/*
+ - dfadone - drop this matcher's reference to the DFA tables
+ == static void dfadone(struct match *m);
+ */
+static void
+dfadone(m)
+struct match *m;
+{
+	struct re_dfa *d = m->g->dfa;
+	struct re_dfatab *t = m->dt;
+
+	if (t == NULL)
+		return;
+	__lock_acquire(d->lock);
+	if (--t->refs == 0)
+		free((char *)t);
+	__lock_release(d->lock);
+	m->dt = NULL;
+}
+
+/*
+ - dfatab - allocate a set of DFA tables
+ == static struct re_dfatab *dfatab(struct match *m, states st);
+ *
+ * States 0 and 1 are always the fresh-start set and the empty set.
+ * The new tables come with the reference held for being current.
+ * Called with the lock held.
+ */
+static struct re_dfatab *
+dfatab(m, st)
+struct match *m;
+states st;			/* scratch */
+{
+	struct re_guts *g = m->g;
+	struct re_dfa *d = g->dfa;
+	const sopno gf = g->firststate+1;
+	const sopno gl = g->laststate;
+	struct re_dfatab *t;
+	size_t tsize;
+
+	tsize = DFA_NSTATES*d->ncols*sizeof(short);
+	t = (struct re_dfatab *)malloc(sizeof(struct re_dfatab) + tsize +
+					DFA_NSTATES*(d->setsize + 1));
+	if (t == NULL)
+		return(NULL);
+	t->refs = 1;
+	t->nds = 0;
+	t->trans = (short *)(t + 1);
+	t->sets = (char *)t->trans + tsize;
+	t->accept = t->sets + DFA_NSTATES*d->setsize;
+	(void) memset(t->trans, 0xff, tsize);
+	CLEAR(st);
+	SET1(st, gf);
+	st = step(g, gf, gl, st, NOTHING, st);
+	(void) dfaintern(m, t, st);
+	CLEAR(st);
+	(void) dfaintern(m, t, st);
+	return(t);
+}
+
+/*
+ - dfaintern - find or add the DFA state for a set of states
+ == static int dfaintern(struct match *m, struct re_dfatab *t, states st);
+ *
+ * Called with the lock held, or before the tables are published.
+ */
+static int			/* state number, -1 if the table is full */
+dfaintern(m, t, st)
+struct match *m;
+struct re_dfatab *t;
+states st;
+{
+	struct re_dfa *d = m->g->dfa;
+	char *sp;
+	int i;
+
+	for (i = 0, sp = t->sets; i < t->nds; i++, sp += d->setsize)
+		if (memcmp(sp, SETPTR(st), d->setsize) == 0)
+			return(i);
+	if (t->nds == DFA_NSTATES)
+		return(-1);
+	(void) memcpy(sp, SETPTR(st), d->setsize);
+	t->accept[i] = ISSET(st, m->g->laststate) ? 1 : 0;
+	t->nds++;
+	return(i);
+}
+
+/*
+ - dfanext - compute a DFA transition and remember it
+ == static int dfanext(struct match *m, int ds, int col, int ch);
+ *
+ * Columns below ncategories are for fast(), which lets a new match
+ * start at every character; the next ncategories are for slow(), which
+ * does not; the rest are the pseudo-characters.  The step is computed
+ * in this matcher's scratch sets; only adding the result to the tables
+ * takes the lock.  If the tables are full, fresh ones replace them and
+ * the new state is added to those; the old ones are freed when the last
+ * matcher using them is done.  If that fails for lack of memory, m->dfa
+ * is cleared and the caller goes back to the state-set simulation.
+ */
+static int			/* next state */
+dfanext(m, ds, col, ch)
+struct match *m;
+int ds;				/* current state */
+int col;			/* transition column */
+int ch;				/* character or NONCHAR code */
+{
+	struct re_guts *g = m->g;
+	struct re_dfa *d = g->dfa;
+	struct re_dfatab *t = m->dt;
+	struct re_dfatab *nt;
+	const sopno gf = g->firststate+1;
+	const sopno gl = g->laststate;
+	states st = m->st;
+	states tmp = m->tmp;
+	int i;
+	int ns;
+
+	/* states already added never change, so no lock is needed here */
+	(void) memcpy(SETPTR(tmp), t->sets + ds*d->setsize, d->setsize);
+	if (col < g->ncategories) {
+		(void) memcpy(SETPTR(st), t->sets, d->setsize);
+		st = step(g, gf, gl, tmp, ch, st);
+	} else if (col < 2*g->ncategories) {
+		CLEAR(st);
+		st = step(g, gf, gl, tmp, ch, st);
+	} else {
+		ASSIGN(st, tmp);
+		if (ch == BOL)
+			i = g->nbol;
+		else if (ch == EOL)
+			i = g->neol;
+		else if (ch == BOLEOL)
+			i = g->nbol + g->neol;
+		else
+			i = 1;
+		for (; i > 0; i--)
+			st = step(g, gf, gl, st, ch, st);
+	}
+
+	__lock_acquire(d->lock);
+	while ((ns = dfaintern(m, t, st)) < 0) {
+		if (t == d->tab) {
+			NOTE("dfa flush");
+			nt = dfatab(m, tmp);
+			if (nt == NULL) {
+				__lock_release(d->lock);
+				m->dfa = NULL;
+				return(0);
+			}
+			d->tab = nt;
+			t->refs--;	/* no longer current; we still hold it */
+		}
+		nt = d->tab;
+		nt->refs++;
+		if (--t->refs == 0)
+			free((char *)t);
+		m->dt = t = nt;
+		ds = -1;	/* numbered in the old tables */
+	}
+	if (ds >= 0)
+		__atomic_store_n(&t->trans[ds*d->ncols + col], (short)ns,
+							__ATOMIC_RELEASE);
+	__lock_release(d->lock);
+	return(ns);
+}
+
+/*
+ - dfaflags - take the BOL/EOL and word-boundary steps between two chars
+ == static int dfaflags(struct match *m, int ds, int lastc, int c);
+ *
+ * This is the same sequence of pseudo-character steps fast() and slow()
+ * take, done on DFA states.  The matcher's tables may be replaced, and
+ * m->dfa cleared, on the way.
+ */
+static int			/* new state */
+dfaflags(m, ds, lastc, c)
+struct match *m;
+int ds;
+int lastc;			/* previous c */
+int c;
+{
+	struct re_guts *g = m->g;
+	const int ncols = m->dfa->ncols;
+	const int base = 2*g->ncategories - BOL;
+	int flagch;
+	int i;
+	int ns;
+
+	flagch = '\0';
+	i = 0;
+	if ( (lastc == '\n' && g->cflags&REG_NEWLINE) ||
+			(lastc == OUT && !(m->eflags&REG_NOTBOL)) ) {
+		flagch = BOL;
+		i = g->nbol;
+	}
+	if ( (c == '\n' && g->cflags&REG_NEWLINE) ||
+			(c == OUT && !(m->eflags&REG_NOTEOL)) ) {
+		flagch = (flagch == BOL) ? BOLEOL : EOL;
+		i += g->neol;
+	}
+	if (i != 0) {
+		ns = __atomic_load_n(&m->dt->trans[ds*ncols + base + flagch],
+							__ATOMIC_ACQUIRE);
+		ds = (ns >= 0) ? ns : dfanext(m, ds, base + flagch, flagch);
+		if (m->dfa == NULL)
+			return(ds);
+	}
+
+	if (!(g->iflags&USEWORD))
+		return(ds);	/* boundaries cannot change anything */
+	if ( (flagch == BOL || (lastc != OUT && !ISWORD(lastc))) &&
+				(c != OUT && ISWORD(c)) ) {
+		flagch = BOW;
+	}
+	if ( (lastc != OUT && ISWORD(lastc)) &&
+			(flagch == EOL || (c != OUT && !ISWORD(c))) ) {
+		flagch = EOW;
+	}
+	if (flagch == BOW || flagch == EOW) {
+		ns = __atomic_load_n(&m->dt->trans[ds*ncols + base + flagch],
+							__ATOMIC_ACQUIRE);
+		ds = (ns >= 0) ? ns : dfanext(m, ds, base + flagch, flagch);
+	}
+	return(ds);
+}
+
+/*
+ - dfast - fast() done with the DFA cache
+ == static char *dfast(struct match *m, char *start, char *stop);
+ *
+ * While no match is under way, the scan can jump straight to the next
+ * occurrence of the literal every match starts with, if there is one.
+ * If m->dfa is cleared on return, the caller must do the scan itself.
+ */
+static char *			/* where tentative match ended, or NULL */
+dfast(m, start, stop)
+struct match *m;
+char *start;
+char *stop;
+{
+	struct re_dfa *d = m->dfa;
+	struct re_dfatab *t = m->dt;
+	const int ncols = d->ncols;
+	const cat_t *cats = m->g->categories;
+	const int nl = (m->g->cflags&REG_NEWLINE) ? '\n' : OUT;
+	const int words = m->g->iflags&USEWORD;
+	char *p = start;
+	int c = (start == m->beginp) ? OUT : *(start-1);
+	int lastc;		/* previous c */
+	int ds = 0;
+	int ns;
+	char *coldp = NULL;	/* last p after which no match was underway */
+	char *q;
+
+	for (;;) {
+		/* next character */
+		lastc = c;
+		c = (p == m->endp) ? OUT : *p;
+		if (ds == 0)
+			coldp = p;
+		if (words || lastc == OUT || c == OUT || lastc == nl ||
+								c == nl) {
+			ds = dfaflags(m, ds, lastc, c);
+			if (m->dfa == NULL)
+				return(NULL);
+			t = m->dt;
+		}
+
+		/* are we done? */
+		if (t->accept[ds] || p == stop)
+			break;		/* NOTE BREAK OUT */
+
+		/* nothing under way, so look for the prefix */
+		if (ds == 0 && d->plen != 0) {
+			if (d->plen == 1)
+				q = memchr(p, d->prefix[0], stop - p);
+			else
+				q = memmem(p, stop - p, d->prefix, d->plen);
+			if (q == NULL) {
+				coldp = p = stop;
+				break;
+			}
+			if (q != p) {
+				p = q;
+				c = *(p-1);
+				continue;
+			}
+		}
+
+		ns = __atomic_load_n(&t->trans[ds*ncols + cats[c]],
+							__ATOMIC_ACQUIRE);
+		if (ns < 0) {
+			ns = dfanext(m, ds, cats[c], c);
+			if (m->dfa == NULL)
+				return(NULL);
+			t = m->dt;
+		}
+		ds = ns;
+		p++;
+	}
+
+	m->coldp = coldp;
+	if (t->accept[ds])
+		return(p+1);
+	else
+		return(NULL);
+}
+
+/*
+ - dslow - slow() done with the DFA cache
+ == static char *dslow(struct match *m, char *start, char *stop);
+ *
+ * If m->dfa is cleared on return, the caller must do the scan itself.
+ */
+static char *			/* where it ended */
+dslow(m, start, stop)
+struct match *m;
+char *start;
+char *stop;
+{
+	struct re_dfatab *t = m->dt;
+	const int ncols = m->dfa->ncols;
+	const int ncat = m->g->ncategories;
+	const cat_t *cats = m->g->categories;
+	const int nl = (m->g->cflags&REG_NEWLINE) ? '\n' : OUT;
+	const int words = m->g->iflags&USEWORD;
+	char *p = start;
+	int c = (start == m->beginp) ? OUT : *(start-1);
+	int lastc;		/* previous c */
+	int ds = 0;
+	int ns;
+	char *matchp = NULL;	/* last p at which a match ended */
+
+	for (;;) {
+		/* next character */
+		lastc = c;
+		c = (p == m->endp) ? OUT : *p;
+		if (words || lastc == OUT || c == OUT || lastc == nl ||
+								c == nl) {
+			ds = dfaflags(m, ds, lastc, c);
+			if (m->dfa == NULL)
+				return(NULL);
+			t = m->dt;
+		}
+
+		/* are we done? */
+		if (t->accept[ds])
+			matchp = p;
+		if (ds == 1 || p == stop)
+			break;		/* NOTE BREAK OUT */
+
+		ns = __atomic_load_n(&t->trans[ds*ncols + ncat + cats[c]],
+							__ATOMIC_ACQUIRE);
+		if (ns < 0) {
+			ns = dfanext(m, ds, ncat + cats[c], c);
+			if (m->dfa == NULL)
+				return(NULL);
+			t = m->dt;
+		}
+		ds = ns;
+		p++;
+	}
+
+	return(matchp);
+}
+
+#else /* !REGEX_DFA */
+
+/*
+ - dfasetup - no DFA cache in this configuration
+ == static struct re_dfa *dfasetup(struct match *m);
+ */
+static struct re_dfa *
+dfasetup(m)
+struct match *m;
+{
+	m->dt = NULL;
+	return(NULL);
+}
+
+/*
+ - dfadone - nothing to release without the DFA cache
+ == static void dfadone(struct match *m);
+ */
+static void
+dfadone(m)
+struct match *m;
+{
+}
+#endif /* REGEX_DFA */
+
 #ifdef REDEBUG
 /*
  - print - print a set of states
@@ -1139,3 +1618,11 @@ int ch;
 #undef	print
 #undef	at
 #undef	match
+#undef	dfasetup
+#undef	dfadone
+#undef	dfatab
+#undef	dfaintern
+#undef	dfanext
+#undef	dfaflags
+#undef	dfast
+#undef	dslow
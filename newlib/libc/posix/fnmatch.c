@@ -57,30 +57,42 @@ static char sccsid[] = "@(#)fnmatch.c	8.2 (Berkeley) 4/16/94";
 
 static int rangematch(const char *, char, int, char **);
 
+/*
+ * A '*' is handled by remembering where it was and, on a later mismatch,
+ * having it swallow one more character and trying again from there.
+ * Only the most recent '*' needs to be remembered: anything an earlier
+ * one could absorb, the later one can absorb too.  This keeps the match
+ * linear in the length of the string times the length of the pattern,
+ * instead of exponential in the number of stars.
+ */
 int
 fnmatch(pattern, string, flags)
 	const char *pattern, *string;
 	int flags;
 {
 	const char *stringstart;
+	const char *bt_pattern, *bt_string;
 	char *newp;
-	char c, test;
+	char c;
 
+	bt_pattern = bt_string = NULL;
 	for (stringstart = string;;)
 		switch (c = *pattern++) {
 		case EOS:
 			if ((flags & FNM_LEADING_DIR) && *string == '/')
 				return (0);
-			return (*string == EOS ? 0 : FNM_NOMATCH);
+			if (*string == EOS)
+				return (0);
+			goto backtrack;
 		case '?':
 			if (*string == EOS)
 				return (FNM_NOMATCH);
 			if (*string == '/' && (flags & FNM_PATHNAME))
-				return (FNM_NOMATCH);
+				goto backtrack;
 			if (*string == '.' && (flags & FNM_PERIOD) &&
 			    (string == stringstart ||
 			    ((flags & FNM_PATHNAME) && *(string - 1) == '/')))
-				return (FNM_NOMATCH);
+				goto backtrack;
 			++string;
 			break;
 		case '*':
@@ -92,7 +104,7 @@ fnmatch(pattern, string, flags)
 			if (*string == '.' && (flags & FNM_PERIOD) &&
 			    (string == stringstart ||
 			    ((flags & FNM_PATHNAME) && *(string - 1) == '/')))
-				return (FNM_NOMATCH);
+				goto backtrack;
 
 			/* Optimize for pattern with * at end or before /. */
 			if (c == EOS)
@@ -108,24 +120,19 @@ fnmatch(pattern, string, flags)
 				break;
 			}
 
-			/* General case, use recursion. */
-			while ((test = *string) != EOS) {
-				if (!fnmatch(pattern, string, flags & ~FNM_PERIOD))
-					return (0);
-				if (test == '/' && flags & FNM_PATHNAME)
-					break;
-				++string;
-			}
-			return (FNM_NOMATCH);
+			/* General case, match nothing for now. */
+			bt_pattern = pattern;
+			bt_string = string;
+			break;
 		case '[':
 			if (*string == EOS)
 				return (FNM_NOMATCH);
 			if (*string == '/' && (flags & FNM_PATHNAME))
-				return (FNM_NOMATCH);
+				goto backtrack;
 			if (*string == '.' && (flags & FNM_PERIOD) &&
 			    (string == stringstart ||
 			    ((flags & FNM_PATHNAME) && *(string - 1) == '/')))
-				return (FNM_NOMATCH);
+				goto backtrack;
 
 			switch (rangematch(pattern, *string, flags, &newp)) {
 			case RANGE_ERROR:
@@ -134,7 +141,7 @@ fnmatch(pattern, string, flags)
 				pattern = newp;
 				break;
 			case RANGE_NOMATCH:
-				return (FNM_NOMATCH);
+				goto backtrack;
 			}
 			++string;
 			break;
@@ -154,8 +161,24 @@ fnmatch(pattern, string, flags)
 				 (tolower((unsigned char)c) ==
 				  tolower((unsigned char)*string)))
 				;
-			else
-				return (FNM_NOMATCH);
+			else {
+		backtrack:
+				/*
+				 * Go back to the last '*' seen and have it
+				 * match one more character, unless that
+				 * would run off the string or, with
+				 * FNM_PATHNAME, cross a '/'.
+				 */
+				if (bt_pattern == NULL)
+					return (FNM_NOMATCH);
+				if (*bt_string == EOS)
+					return (FNM_NOMATCH);
+				if (*bt_string == '/' && (flags & FNM_PATHNAME))
+					return (FNM_NOMATCH);
+				pattern = bt_pattern;
+				string = ++bt_string;
+				break;
+			}
 			string++;
 			break;
 		}
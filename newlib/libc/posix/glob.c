@@ -132,6 +132,18 @@ typedef char Char;
 #define	M_SET		META('[')
 #define	ismeta(c)	(((c)&M_QUOTE) != 0)
 
+/*
+ * Having a d_type member doesn't mean readdir() fills it in: Linux's
+ * readdir() uses the old getdents call, which returns no type.  So
+ * d_type is only used where <sys/dirent.h> says readdir() sets it.
+ */
+#if defined(HAVE_READDIR_D_TYPE) && defined(DT_UNKNOWN)
+#define	GLOB_DTYPE	/* readdir() tells us the file type */
+#endif
+
+/* first allocation for a directory's matching names in glob3() */
+#define	GLOB_NAMEBUF	1024
+
 
 static int	 compare(const void *, const void *);
 static int	 g_Ctoc(const Char *, char *, u_int);
@@ -147,6 +159,7 @@ static int	 glob1(Char *, glob_t *, int *);
 static int	 glob2(Char *, Char *, Char *, Char *, glob_t *, int *);
 static int	 glob3(Char *, Char *, Char *, Char *, Char *, glob_t *, int *);
 static int	 globextend(const Char *, glob_t *, int *);
+static u_int	 globvecsize(u_int);
 static const Char *	
 		 globtilde(const Char *, Char *, size_t, glob_t *);
 static int	 globexp1(const Char *, glob_t *, int *);
@@ -610,6 +623,12 @@ glob3(pathbuf, pathend, pathend_last, pattern, restpattern, pglob, limit)
 	DIR *dirp;
 	int err;
 	char buf[MAXPATHLEN];
+	char *names, *np, *nend;
+	size_t nsize, used, len;
+#ifdef GLOB_DTYPE
+	int dtype;
+	struct stat sb;
+#endif
 
 	/*
 	 * The readdirfunc declaration can't be prototyped, because it is
@@ -636,14 +655,22 @@ glob3(pathbuf, pathend, pathend_last, pattern, restpattern, pglob, limit)
 		return(0);
 	}
 
+	/*
+	 * Read the whole directory first, keeping the matching names as
+	 * a type byte followed by the NUL-terminated name, and close it
+	 * before descending.  That way only one directory is open at a
+	 * time, however deep the pattern.
+	 */
 	err = 0;
-
-	/* Search directory for matching names. */
+	nsize = GLOB_NAMEBUF;
+	names = nend = malloc(nsize);
+	if (names == NULL)
+		err = GLOB_NOSPACE;
 	if (pglob->gl_flags & GLOB_ALTDIRFUNC)
 		readdirfunc = pglob->gl_readdir;
 	else
 		readdirfunc = readdir;
-	while ((dp = (*readdirfunc)(dirp))) {
+	while (!err && (dp = (*readdirfunc)(dirp))) {
 		u_char *sc;
 		Char *dc;
 
@@ -654,32 +681,101 @@ glob3(pathbuf, pathend, pathend_last, pattern, restpattern, pglob, limit)
 		sc = (u_char *) dp->d_name;
 		while (dc < pathend_last && (*dc++ = *sc++) != EOS)
 			;
-		if (!match(pathend, pattern, restpattern)) {
-			*pathend = EOS;
+		if (!match(pathend, pattern, restpattern))
 			continue;
+
+		len = strlen(dp->d_name) + 2;
+		if (nend + len > names + nsize) {
+			used = nend - names;
+			np = realloc(names, 2 * nsize + len);
+			if (np == NULL) {
+				err = GLOB_NOSPACE;
+				break;
+			}
+			nend = np + used;
+			names = np;
+			nsize = 2 * nsize + len;
 		}
-		err = glob2(pathbuf, --dc, pathend_last, restpattern,
-		    pglob, limit);
-		if (err)
-			break;
+#ifdef GLOB_DTYPE
+		/* d_type is not ours to trust from alternate functions */
+		*nend++ = (pglob->gl_flags & GLOB_ALTDIRFUNC) ?
+		    DT_UNKNOWN : dp->d_type;
+#else
+		*nend++ = 0;
+#endif
+		memcpy(nend, dp->d_name, len - 1);
+		nend += len - 1;
 	}
 
 	if (pglob->gl_flags & GLOB_ALTDIRFUNC)
 		(*pglob->gl_closedir)(dirp);
 	else
 		closedir(dirp);
+
+	for (np = names; !err && np < nend; np += len) {
+		u_char *sc;
+		Char *dc;
+
+#ifdef GLOB_DTYPE
+		dtype = (u_char)*np;
+#endif
+		len = strlen(++np) + 1;
+		dc = pathend;
+		sc = (u_char *) np;
+		while (dc < pathend_last && (*dc++ = *sc++) != EOS)
+			;
+#ifdef GLOB_DTYPE
+		/*
+		 * A last segment read from the directory is known to
+		 * exist, so lstat() is only needed if GLOB_MARK wants to
+		 * know whether a symbolic link points at a directory.
+		 */
+		if (*restpattern == EOS && dtype != DT_UNKNOWN) {
+			--dc;
+			if ((pglob->gl_flags & GLOB_MARK) &&
+			    (dtype == DT_DIR || (dtype == DT_LNK &&
+			    g_stat(pathbuf, &sb, pglob) == 0 &&
+			    S_ISDIR(sb.st_mode)))) {
+				if (dc + 1 > pathend_last) {
+					err = 1;
+					break;
+				}
+				*dc++ = SEP;
+				*dc = EOS;
+			}
+			++pglob->gl_matchc;
+			err = globextend(pathbuf, pglob, limit);
+			continue;
+		}
+#endif
+		err = glob2(pathbuf, --dc, pathend_last, restpattern,
+		    pglob, limit);
+	}
+
+	if (names != NULL)
+		free(names);
 	return(err);
 }
 
 
+/*
+ * Number of gl_pathv slots allocated when n are in use.
+ */
+static u_int
+globvecsize(n)
+	u_int n;
+{
+	u_int size;
+
+	for (size = 16; size < n; size <<= 1)
+		continue;
+	return (size);
+}
+
 /*
  * Extend the gl_pathv member of a glob_t structure to accomodate a new item,
  * add the new item, and update gl_pathc.
  *
- * This assumes the BSD realloc, which only copies the block when its size
- * crosses a power-of-two boundary; for v7 realloc, this would cause quadratic
- * behavior.
- *
  * Return 0 if new item added, error code if memory couldn't be allocated.
  *
  * Invariant of the glob_t structure:
@@ -694,7 +790,7 @@ globextend(path, pglob, limit)
 {
 	char **pathv;
 	int i;
-	u_int newsize, len;
+	u_int oldsize, newsize, len;
 	char *copy;
 	const Char *p;
 
@@ -703,17 +799,28 @@ globextend(path, pglob, limit)
 		return (GLOB_NOSPACE);
 	}
 
-	newsize = sizeof(*pathv) * (2 + pglob->gl_pathc + pglob->gl_offs);
-	pathv = pglob->gl_pathv ?
-		    realloc((char *)pglob->gl_pathv, newsize) :
-		    malloc(newsize);
-	if (pathv == NULL) {
-		if (pglob->gl_pathv) {
-			free(pglob->gl_pathv);
-			pglob->gl_pathv = NULL;
+	/*
+	 * Grow the vector to the next power of two, so that adding n
+	 * paths costs O(log n) reallocs.  The size in use is always
+	 * derived from gl_pathc, so no extra bookkeeping is needed.
+	 */
+	oldsize = pglob->gl_pathv ? globvecsize(1 + pglob->gl_pathc +
+	    pglob->gl_offs) : 0;
+	newsize = globvecsize(2 + pglob->gl_pathc + pglob->gl_offs);
+	if (newsize != oldsize) {
+		pathv = pglob->gl_pathv ?
+			    realloc((char *)pglob->gl_pathv,
+			    newsize * sizeof(*pathv)) :
+			    malloc(newsize * sizeof(*pathv));
+		if (pathv == NULL) {
+			if (pglob->gl_pathv) {
+				free(pglob->gl_pathv);
+				pglob->gl_pathv = NULL;
+			}
+			return(GLOB_NOSPACE);
 		}
-		return(GLOB_NOSPACE);
-	}
+	} else
+		pathv = pglob->gl_pathv;
 
 	if (pglob->gl_pathv == NULL && pglob->gl_offs > 0) {
 		/* first time around -- clear initial gl_offs items */
@@ -738,8 +845,10 @@ globextend(path, pglob, limit)
 }
 
 /*
- * pattern matching function for filenames.  Each occurrence of the *
- * pattern causes a recursion level.
+ * pattern matching function for filenames.  A * remembers where it was;
+ * on a later mismatch it takes one more character and the match resumes
+ * from there.  Only the last * needs remembering, so this is linear in
+ * the name for each *, with no recursion.
  */
 static int
 match(name, pat, patend)
@@ -747,18 +856,23 @@ match(name, pat, patend)
 {
 	int ok, negate_range;
 	Char c, k;
+	Char *bt_pat, *bt_name;
 
-	while (pat < patend) {
+	bt_pat = bt_name = NULL;
+	for (;;) {
+		if (pat == patend) {
+			if (*name == EOS)
+				return(1);
+			goto backtrack;
+		}
 		c = *pat++;
 		switch (c & M_MASK) {
 		case M_ALL:
 			if (pat == patend)
 				return(1);
-			do
-			    if (match(name, pat, patend))
-				    return(1);
-			while (*name++ != EOS);
-			return(0);
+			bt_pat = pat;
+			bt_name = name;
+			break;
 		case M_ONE:
 			if (*name++ == EOS)
 				return(0);
@@ -781,15 +895,21 @@ match(name, pat, patend)
 				} else if (c == k)
 					ok = 1;
 			if (ok == negate_range)
-				return(0);
+				goto backtrack;
 			break;
 		default:
 			if (*name++ != c)
-				return(0);
+				goto backtrack;
 			break;
 		}
+		continue;
+	backtrack:
+		if (bt_pat == NULL || *bt_name == EOS)
+			return(0);
+		pat = bt_pat;
+		name = ++bt_name;
 	}
-	return(*name == EOS);
+	/* NOTREACHED */
 }
 
 /* Free allocated data belonging to a glob_t structure. */
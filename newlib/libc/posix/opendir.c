@@ -39,6 +39,10 @@ static char sccsid[] = "@(#)opendir.c	5.11 (Berkeley) 2/23/91";
 #include <unistd.h>
 #include <sys/lock.h>
 
+#ifndef DIRBUFSIZ
+#define DIRBUFSIZ 512
+#endif
+
 static DIR *
 _opendir_common(int fd)
 {
@@ -54,8 +58,8 @@ _opendir_common(int fd)
 	 * Hopefully this can be a big win someday by allowing page trades
 	 * to user space to be done by getdirentries()
 	 */
-	dirp->dd_buf = malloc (512);
-	dirp->dd_len = 512;
+	dirp->dd_buf = malloc (DIRBUFSIZ);
+	dirp->dd_len = DIRBUFSIZ;
 
 	if (dirp->dd_buf == NULL) {
 		free (dirp);
@@ -47,6 +47,7 @@ static char sccsid[] = "@(#)regcomp.c	8.5 (Berkeley) 3/20/94";
 #include <limits.h>
 #include <stdlib.h>
 #include <regex.h>
+#include <sys/lock.h>
 
 #include "collate.h"
 
@@ -125,6 +126,9 @@ static int altoffset(sop *scan, int offset, int mccs);
 static void computejumps(struct parse *p, struct re_guts *g);
 static void computematchjumps(struct parse *p, struct re_guts *g);
 static sopno pluscount(struct parse *p, struct re_guts *g);
+#ifdef REGEX_DFA
+static void dfacomp(struct parse *p, struct re_guts *g);
+#endif
 
 #ifdef __cplusplus
 }
@@ -253,6 +257,7 @@ int cflags;
 	g->categories = &g->catspace[-(CHAR_MIN)];
 	(void) memset((char *)g->catspace, 0, NC*sizeof(cat_t));
 	g->backrefs = 0;
+	g->dfa = NULL;
 
 	/* do it */
 	EMIT(OEND, 0);
@@ -282,6 +287,9 @@ int cflags;
 		}
 	}
 	g->nplus = pluscount(p, g);
+#ifdef REGEX_DFA
+	dfacomp(p, g);
+#endif
 	g->magic = MAGIC2;
 	preg->re_nsub = g->nsub;
 	preg->re_g = g;
@@ -702,11 +710,13 @@ struct parse *p;
 	/* Dept of Truly Sickening Special-Case Kludges */
 	if (p->next + 5 < p->end && strncmp(p->next, "[:<:]]", 6) == 0) {
 		EMIT(OBOW, 0);
+		p->g->iflags |= USEWORD;
 		NEXTn(6);
 		return;
 	}
 	if (p->next + 5 < p->end && strncmp(p->next, "[:>:]]", 6) == 0) {
 		EMIT(OEOW, 0);
+		p->g->iflags |= USEWORD;
 		NEXTn(6);
 		return;
 	}
@@ -2085,4 +2095,55 @@ struct re_guts *g;
 	return(maxnest);
 }
 
+#ifdef REGEX_DFA
+/*
+ - dfacomp - set up the DFA cache and find the literal prefix
+ == static void dfacomp(struct parse *p, struct re_guts *g);
+ *
+ * Only the header is allocated here; regexec() builds the tables the
+ * first time it needs them.  Back references cannot be done by a DFA,
+ * and very long strips would make each stored state set too large, so
+ * those expressions are left to the state-set simulation.  Failure to
+ * get memory is not an error, the RE just runs without the cache.
+ */
+static void
+dfacomp(p, g)
+struct parse *p;
+struct re_guts *g;
+{
+	struct re_dfa *d;
+	sop *scan;
+	sop s;
+	char *cp;
+	size_t plen;
+
+	if (p->error != 0 || (g->iflags&BAD) || g->backrefs ||
+						g->nstates > DFA_MAXSTRIP)
+		return;
+
+	/* leading literal, looking through parentheses only */
+	plen = 0;
+	for (scan = g->strip + 1; OP(s = *scan) != OEND; scan++)
+		if (OP(s) == OCHAR)
+			plen++;
+		else if (OP(s) != OLPAREN && OP(s) != ORPAREN)
+			break;
+
+	d = (struct re_dfa *)malloc(sizeof(struct re_dfa) + plen);
+	if (d == NULL)
+		return;
+	d->ncols = 0;
+	d->setsize = 0;
+	d->tab = NULL;
+	d->prefix = (char *)(d + 1);
+	d->plen = plen;
+	cp = d->prefix;
+	for (scan = g->strip + 1; cp < d->prefix + plen; scan++)
+		if (OP(*scan) == OCHAR)
+			*cp++ = (char)OPND(*scan);
+	__lock_init(d->lock);
+	g->dfa = d;
+}
+#endif /* REGEX_DFA */
+
 #endif /* !_NO_REGEX  */
@@ -133,6 +133,48 @@ typedef struct {
 /* stuff for character categories */
 typedef unsigned char cat_t;
 
+/*
+ * Lazily built DFA for expressions without back references.  regcomp()
+ * allocates the header and finds the literal prefix; the tables are set
+ * up by regexec() on first use and filled in as transitions are needed.
+ * A DFA state is a set of strip states, stored in whatever representation
+ * the matcher uses.  Each state has one transition per character category
+ * for the unanchored scan (fast()), one per category for the anchored scan
+ * (slow()), and one per pseudo-character code from BOL up.  State 0
+ * is the fresh-start set, state 1 the empty set.  When the tables fill
+ * up, fresh ones with just those two replace them.
+ *
+ * Matchers read the tables without locking: a state is never changed
+ * once added, and a transition is stored only after the state it leads
+ * to.  The lock is taken to add states and to replace or release tables;
+ * each matcher holds a reference to the tables it is using.
+ *
+ * The DFA is left out of builds optimized for size, and needs GCC's
+ * __atomic builtins.
+ */
+#if !defined(PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__) && \
+    defined(__GNUC__)
+#define	REGEX_DFA
+#endif
+#define	DFA_NSTATES	64	/* DFA states kept per RE */
+#define	DFA_NPSEUDO	6	/* pseudo-character transitions per state */
+#define	DFA_MAXSTRIP	1024	/* no DFA for strips longer than this */
+struct re_dfatab {
+	int refs;		/* matchers using these, +1 while current */
+	int nds;		/* DFA states in use */
+	short *trans;		/* -> short[DFA_NSTATES][ncols], -1 unknown */
+	char *sets;		/* -> char[DFA_NSTATES][setsize] */
+	char *accept;		/* -> char[DFA_NSTATES], final state in set */
+};
+struct re_dfa {
+	int ncols;		/* transitions per state */
+	size_t setsize;		/* bytes per stored state set */
+	struct re_dfatab *tab;	/* current tables, NULL until first use */
+	char *prefix;		/* every match starts with this literal */
+	size_t plen;		/* length of prefix */
+	_LOCK_T lock;		/* guards tab, refs and adding states */
+};
+
 /*
  * main compiled-expression structure
  */
@@ -152,6 +194,7 @@ struct re_guts {
 #		define	USEBOL	01	/* used ^ */
 #		define	USEEOL	02	/* used $ */
 #		define	BAD	04	/* something wrong */
+#		define	USEWORD	010	/* used [[:<:]] or [[:>:]] */
 	int nbol;		/* number of ^ used */
 	int neol;		/* number of $ used */
 	int ncategories;	/* how many character categories */
@@ -164,6 +207,7 @@ struct re_guts {
 	size_t nsub;		/* copy of re_nsub */
 	int backrefs;		/* does it use back references? */
 	sopno nplus;		/* how deep does it nest +s? */
+	struct re_dfa *dfa;	/* DFA cache, NULL if not usable */
 	/* catspace must be last */
 	cat_t catspace[1];	/* actually [NC] */
 };
@@ -35,6 +35,9 @@
 
 #ifndef _NO_REGEX
 
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE	/* memmem */
+#endif
 #if defined(LIBC_SCCS) && !defined(lint)
 static char sccsid[] = "@(#)regexec.c	8.3 (Berkeley) 3/20/94";
 #endif /* LIBC_SCCS and not lint */
@@ -54,6 +57,7 @@ static char sccsid[] = "@(#)regexec.c	8.3 (Berkeley) 3/20/94";
 #include <limits.h>
 #include <ctype.h>
 #include <regex.h>
+#include <sys/lock.h>
 
 #include "utils.h"
 #include "regex2.h"
@@ -84,6 +88,9 @@ static int nope = 0;		/* for use in asserts; shuts lint up */
 #define	FWD(dst, src, n)	((dst) |= ((unsigned long)(src)&(here)) << (n))
 #define	BACK(dst, src, n)	((dst) |= ((unsigned long)(src)&(here)) >> (n))
 #define	ISSETBACK(v, n)	(((v) & ((unsigned long)here >> (n))) != 0)
+/* state sets as stored in the DFA cache */
+#define	SETBYTES	sizeof(long)
+#define	SETPTR(v)	((char *)&(v))
 /* function names */
 #define SNAMES			/* engine.c looks after details */
 
@@ -108,6 +115,8 @@ static int nope = 0;		/* for use in asserts; shuts lint up */
 #undef	FWD
 #undef	BACK
 #undef	ISSETBACK
+#undef	SETBYTES
+#undef	SETPTR
 #undef	SNAMES
 
 /* macros for manipulating states, large version */
@@ -133,6 +142,9 @@ static int nope = 0;		/* for use in asserts; shuts lint up */
 #define	FWD(dst, src, n)	((dst)[here+(n)] |= (src)[here])
 #define	BACK(dst, src, n)	((dst)[here-(n)] |= (src)[here])
 #define	ISSETBACK(v, n)	((v)[here - (n)])
+/* state sets as stored in the DFA cache */
+#define	SETBYTES	((size_t)m->g->nstates)
+#define	SETPTR(v)	(v)
 /* function names */
 #define	LNAMES			/* flag */
 
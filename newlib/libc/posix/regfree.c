@@ -45,6 +45,7 @@ static char sccsid[] = "@(#)regfree.c	8.3 (Berkeley) 3/20/94";
 #include <stdlib.h>
 #include <limits.h>
 #include <regex.h>
+#include <sys/lock.h>
 
 #include "utils.h"
 #include "regex2.h"
@@ -80,6 +81,12 @@ regex_t *preg;
 		free(&g->charjump[CHAR_MIN]);
 	if (g->matchjump != NULL)
 		free(g->matchjump);
+	if (g->dfa != NULL) {
+		__lock_close(g->dfa->lock);
+		if (g->dfa->tab != NULL)
+			free((char *)g->dfa->tab);
+		free((char *)g->dfa);
+	}
 	free((char *)g);
 }
 
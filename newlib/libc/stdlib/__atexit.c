@@ -150,6 +150,10 @@ __register_exitproc (int type,
       args->_dso_handle[p->_ind] = d;
       if (type == __et_cxa)
 	args->_is_cxa |= (1 << p->_ind);
+#ifdef _ATEXIT_DSO_INDEX
+      if (d)
+	__atexit_dso_add (p, p->_ind, d);
+#endif
     }
   p->_fns[p->_ind++] = fn;
 #ifndef __SINGLE_THREAD__
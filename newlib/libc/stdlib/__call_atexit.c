@@ -4,6 +4,7 @@
 
 
 #include <stdlib.h>
+#include <string.h>
 #include <reent.h>
 #include <sys/lock.h>
 #include "atexit.h"
@@ -61,6 +62,183 @@ register_fini(void)
 
 #endif /* _WANT_REGISTER_FINI  */
 
+#ifdef _ATEXIT_DSO_INDEX
+
+/* The handlers registered with each DSO handle, in registration order.
+   An entry is dropped as soon as its handler is removed from its block,
+   so the index never refers to a freed block.  If an allocation fails the
+   index is incomplete and __cxa_finalize goes back to scanning all
+   blocks.  */
+struct _atexit_dso
+{
+  struct _atexit_dso *next;
+  void *d;
+  int n, size;
+  struct _atexit_ent
+  {
+    struct _atexit *p;
+    int ind;
+  } *ent;
+};
+
+#define _ATEXIT_DSO_HASH 64
+#define _ATEXIT_DSO_BUCKET(d) \
+  (&dso_hash[((size_t) (d) >> 4) % _ATEXIT_DSO_HASH])
+
+static struct _atexit_dso *dso_hash[_ATEXIT_DSO_HASH];
+static int dso_index_lost;
+
+static struct _atexit_dso *
+dso_find (void *d)
+{
+  struct _atexit_dso *dso;
+
+  for (dso = *_ATEXIT_DSO_BUCKET (d); dso; dso = dso->next)
+    if (dso->d == d)
+      break;
+  return dso;
+}
+
+/* Called by __register_exitproc with the lock held.  */
+
+void
+__atexit_dso_add (struct _atexit *p,
+	int ind,
+	void *d)
+{
+  struct _atexit_dso **bucket = _ATEXIT_DSO_BUCKET (d);
+  struct _atexit_dso *dso;
+
+  if (dso_index_lost)
+    return;
+  dso = dso_find (d);
+  if (dso == NULL)
+    {
+      dso = (struct _atexit_dso *) malloc (sizeof *dso);
+      if (dso == NULL)
+	goto lost;
+      dso->d = d;
+      dso->n = dso->size = 0;
+      dso->ent = NULL;
+      dso->next = *bucket;
+      *bucket = dso;
+    }
+  if (dso->n == dso->size)
+    {
+      int size = dso->size ? 2 * dso->size : 8;
+      struct _atexit_ent *ent;
+
+      ent = (struct _atexit_ent *) realloc (dso->ent, size * sizeof *ent);
+      if (ent == NULL)
+	goto lost;
+      dso->ent = ent;
+      dso->size = size;
+    }
+  dso->ent[dso->n].p = p;
+  dso->ent[dso->n].ind = ind;
+  dso->n++;
+  return;
+
+ lost:
+  dso_index_lost = 1;
+}
+
+/* Forget handler IND of block P, which is being removed.  Handlers run
+   in reverse order, so it is almost always the last entry.  */
+
+static void
+dso_drop (struct _atexit *p,
+	int ind,
+	void *d)
+{
+  struct _atexit_dso *dso = dso_find (d);
+  int k;
+
+  if (dso == NULL)
+    return;
+  for (k = dso->n - 1; k >= 0; k--)
+    if (dso->ent[k].p == p && dso->ent[k].ind == ind)
+      {
+	memmove (&dso->ent[k], &dso->ent[k + 1],
+		 (dso->n - k - 1) * sizeof dso->ent[0]);
+	dso->n--;
+	break;
+      }
+}
+
+/* __call_exitprocs for a single DSO, with the lock held.  */
+
+static void
+call_dso_exitprocs (int code,
+	void *d)
+{
+  struct _atexit_dso *dso, **dsop;
+  struct _atexit *p, **lastp;
+  struct _on_exit_args *args;
+  void (*fn) (void);
+  int n, i, emptied = 0;
+
+  /* Take the most recent handler each time round: those registered by
+     the handler just called are at the end and run next.  */
+  while ((dso = dso_find (d)) != NULL && dso->n > 0)
+    {
+      dso->n--;
+      p = dso->ent[dso->n].p;
+      n = dso->ent[dso->n].ind;
+      i = 1 << n;
+#ifdef _REENT_SMALL
+      args = p->_on_exit_args_ptr;
+#else
+      args = &p->_on_exit_args;
+#endif
+
+      fn = p->_fns[n];
+      if (n == p->_ind - 1)
+	{
+	  if (--p->_ind == 0)
+	    emptied = 1;
+	}
+      else
+	p->_fns[n] = NULL;
+
+      if (!fn)
+	continue;
+
+      if ((args->_is_cxa & i) == 0)
+	(*((void (*)(int, void *)) fn))(code, args->_fnargs[n]);
+      else
+	(*((void (*)(void *)) fn))(args->_fnargs[n]);
+    }
+
+  for (dsop = _ATEXIT_DSO_BUCKET (d); *dsop; dsop = &(*dsop)->next)
+    if (*dsop == dso)
+      {
+	*dsop = dso->next;
+	free (dso->ent);
+	free (dso);
+	break;
+      }
+
+  /* Free empty blocks except the last one, as __call_exitprocs does.  */
+  if (emptied)
+    {
+      for (lastp = &_GLOBAL_ATEXIT; (p = *lastp) != NULL; )
+	if (p->_ind == 0 && p->_next)
+	  {
+	    *lastp = p->_next;
+#ifdef _REENT_SMALL
+	    if (p->_on_exit_args_ptr)
+	      free (p->_on_exit_args_ptr);
+#endif
+	    free (p);
+	  }
+	else
+	  lastp = &p->_next;
+    }
+}
+
+#endif /* _ATEXIT_DSO_INDEX */
+
 /*
  * Call registered exit handlers.  If D is null then all handlers are called,
  * otherwise only the handlers from that DSO are called.
@@ -81,6 +259,17 @@ __call_exitprocs (int code, void *d)
   __lock_acquire_recursive(__atexit_recursive_mutex);
 #endif
 
+#ifdef _ATEXIT_DSO_INDEX
+  if (d && !dso_index_lost)
+    {
+      call_dso_exitprocs (code, d);
+#ifndef __SINGLE_THREAD__
+      __lock_release_recursive(__atexit_recursive_mutex);
+#endif
+      return;
+    }
+#endif
+
  restart:
 
   p = _GLOBAL_ATEXIT;
@@ -110,6 +299,11 @@ __call_exitprocs (int code, void *d)
 	  else
 	    p->_fns[n] = NULL;
 
+#ifdef _ATEXIT_DSO_INDEX
+	  if (args && (args->_fntypes & i) && args->_dso_handle[n])
+	    dso_drop (p, n, args->_dso_handle[n]);
+#endif
+
 	  /* Skip functions that have already been called.  */
 	  if (!fn)
 	    continue;
@@ -25,6 +25,7 @@
 
 #include <fcntl.h>
 #include <limits.h>
+#include <reent.h>
 #include <signal.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -33,6 +34,10 @@
 #include <sys/types.h>
 #include <sys/time.h>
 
+#if defined(__GNUC__) && !defined(PREFER_SIZE_OVER_SPEED) && \
+    !defined(__OPTIMIZE_SIZE__)
+#define CHACHA_BLOCKS
+#endif
 #define KEYSTREAM_ONLY
 #include "chacha_private.h"
 
@@ -49,81 +54,94 @@
 #define RSBUFSZ	(16*BLOCKSZ)
 
 /* Marked MAP_INHERIT_ZERO, so zero'd out in fork children. */
-static struct _rs {
+struct _rs {
 	size_t		rs_have;	/* valid bytes at end of rs_buf */
 	size_t		rs_count;	/* bytes till reseed */
-} *rs;
+};
 
 /* Maybe be preserved in fork children, if _rs_allocate() decides. */
-static struct _rsx {
+struct _rsx {
 	chacha_ctx	rs_chacha;	/* chacha context for random keystream */
 	u_char		rs_buf[RSBUFSZ];	/* keystream blocks */
-} *rsx;
+};
+
+/* A generator, one of _ARC4RANDOM_POOL if defined, see arc4random.h. */
+struct _arc4 {
+	struct _rs	*rs;
+	struct _rsx	*rsx;
+};
 
-static inline int _rs_allocate(struct _rs **, struct _rsx **);
+static inline int _rs_allocate(struct _arc4 *);
 static inline void _rs_forkdetect(void);
 #include "arc4random.h"
 
-static inline void _rs_rekey(u_char *dat, size_t datlen);
+static inline void _rs_rekey(struct _arc4 *, u_char *dat, size_t datlen);
 
 static inline void
-_rs_init(u_char *buf, size_t n)
+_rs_init(struct _arc4 *a, u_char *buf, size_t n)
 {
 	if (n < KEYSZ + IVSZ)
 		return;
 
-	if (rs == NULL) {
-		if (_rs_allocate(&rs, &rsx) == -1)
+	if (a->rs == NULL) {
+		if (_rs_allocate(a) == -1)
 			abort();
 	}
 
-	chacha_keysetup(&rsx->rs_chacha, buf, KEYSZ * 8, 0);
-	chacha_ivsetup(&rsx->rs_chacha, buf + KEYSZ);
+	chacha_keysetup(&a->rsx->rs_chacha, buf, KEYSZ * 8, 0);
+	chacha_ivsetup(&a->rsx->rs_chacha, buf + KEYSZ);
 }
 
 static void
-_rs_stir(void)
+_rs_stir(struct _arc4 *a)
 {
 	u_char rnd[KEYSZ + IVSZ];
 
 	if (getentropy(rnd, sizeof rnd) == -1)
 		_getentropy_fail();
 
-	if (!rs)
-		_rs_init(rnd, sizeof(rnd));
+	if (!a->rs)
+		_rs_init(a, rnd, sizeof(rnd));
 	else
-		_rs_rekey(rnd, sizeof(rnd));
+		_rs_rekey(a, rnd, sizeof(rnd));
 	explicit_bzero(rnd, sizeof(rnd));	/* discard source seed */
 
 	/* invalidate rs_buf */
-	rs->rs_have = 0;
-	memset(rsx->rs_buf, 0, sizeof(rsx->rs_buf));
+	a->rs->rs_have = 0;
+	memset(a->rsx->rs_buf, 0, sizeof(a->rsx->rs_buf));
 
-	rs->rs_count = (SIZE_MAX <= 65535) ? 65000
+	a->rs->rs_count = (SIZE_MAX <= 65535) ? 65000
 	  : (SIZE_MAX <= 1048575 ? 1048000 : 1600000);
 }
 
 static inline void
-_rs_stir_if_needed(size_t len)
+_rs_stir_if_needed(struct _arc4 *a, size_t len)
 {
 	_rs_forkdetect();
-	if (!rs || rs->rs_count <= len)
-		_rs_stir();
-	if (rs->rs_count <= len)
-		rs->rs_count = 0;
+	if (!a->rs || a->rs->rs_count <= len)
+		_rs_stir(a);
+	if (a->rs->rs_count <= len)
+		a->rs->rs_count = 0;
 	else
-		rs->rs_count -= len;
+		a->rs->rs_count -= len;
 }
 
 static inline void
-_rs_rekey(u_char *dat, size_t datlen)
+_rs_rekey(struct _arc4 *a, u_char *dat, size_t datlen)
 {
+	struct _rsx *rsx = a->rsx;
+
 #ifndef KEYSTREAM_ONLY
 	memset(rsx->rs_buf, 0, sizeof(rsx->rs_buf));
 #endif
 	/* fill rs_buf with the keystream */
+#ifdef CHACHA_BLOCKS
+	chacha_keystream_blocks(&rsx->rs_chacha, rsx->rs_buf,
+	    sizeof(rsx->rs_buf) / BLOCKSZ);
+#else
 	chacha_encrypt_bytes(&rsx->rs_chacha, rsx->rs_buf,
 	    rsx->rs_buf, sizeof(rsx->rs_buf));
+#endif
 	/* mix in optional user provided data */
 	if (dat) {
 		size_t i, m;
@@ -133,72 +151,135 @@ _rs_rekey(u_char *dat, size_t datlen)
 			rsx->rs_buf[i] ^= dat[i];
 	}
 	/* immediately reinit for backtracking resistance */
-	_rs_init(rsx->rs_buf, KEYSZ + IVSZ);
+	_rs_init(a, rsx->rs_buf, KEYSZ + IVSZ);
 	memset(rsx->rs_buf, 0, KEYSZ + IVSZ);
-	rs->rs_have = sizeof(rsx->rs_buf) - KEYSZ - IVSZ;
+	a->rs->rs_have = sizeof(rsx->rs_buf) - KEYSZ - IVSZ;
 }
 
 static inline void
-_rs_random_buf(void *_buf, size_t n)
+_rs_random_buf(struct _arc4 *a, void *_buf, size_t n)
 {
 	u_char *buf = (u_char *)_buf;
 	u_char *keystream;
 	size_t m;
 
-	_rs_stir_if_needed(n);
+	_rs_stir_if_needed(a, n);
 	while (n > 0) {
-		if (rs->rs_have > 0) {
-			m = min(n, rs->rs_have);
-			keystream = rsx->rs_buf + sizeof(rsx->rs_buf)
-			    - rs->rs_have;
+		if (a->rs->rs_have > 0) {
+			m = min(n, a->rs->rs_have);
+			keystream = a->rsx->rs_buf + sizeof(a->rsx->rs_buf)
+			    - a->rs->rs_have;
 			memcpy(buf, keystream, m);
 			memset(keystream, 0, m);
 			buf += m;
 			n -= m;
-			rs->rs_have -= m;
+			a->rs->rs_have -= m;
 		}
-		if (rs->rs_have == 0)
-			_rs_rekey(NULL, 0);
+#ifdef CHACHA_BLOCKS
+		/*
+		 * Write whole blocks of a large request straight into the
+		 * caller's buffer; the rekey below then discards the key.
+		 */
+		if (n >= 4 * BLOCKSZ) {
+			m = n & ~(size_t)(4 * BLOCKSZ - 1);
+			chacha_keystream_blocks(&a->rsx->rs_chacha, buf,
+			    m / BLOCKSZ);
+			buf += m;
+			n -= m;
+		}
+#endif
+		if (a->rs->rs_have == 0)
+			_rs_rekey(a, NULL, 0);
 	}
 }
 
 static inline void
-_rs_random_u32(uint32_t *val)
+_rs_random_u32(struct _arc4 *a, uint32_t *val)
 {
 	u_char *keystream;
 
-	_rs_stir_if_needed(sizeof(*val));
-	if (rs->rs_have < sizeof(*val))
-		_rs_rekey(NULL, 0);
-	keystream = rsx->rs_buf + sizeof(rsx->rs_buf) - rs->rs_have;
+	_rs_stir_if_needed(a, sizeof(*val));
+	if (a->rs->rs_have < sizeof(*val))
+		_rs_rekey(a, NULL, 0);
+	keystream = a->rsx->rs_buf + sizeof(a->rsx->rs_buf) - a->rs->rs_have;
 	memcpy(val, keystream, sizeof(*val));
 	memset(keystream, 0, sizeof(*val));
-	rs->rs_have -= sizeof(*val);
+	a->rs->rs_have -= sizeof(*val);
 }
 
-uint32_t
-arc4random(void)
+#ifdef _ARC4RANDOM_POOL
+/*
+ * Take a free generator, starting at one picked by the calling thread's
+ * reentrancy structure so that threads tend to stay on their own one.
+ * If one pass finds them all busy, wait for the one kept under the lock.
+ */
+static inline struct _arc4 *
+_arc4_acquire(void)
 {
-	uint32_t val;
+	uintptr_t h = (uintptr_t)_REENT;
+	unsigned int i, n;
+
+	i = (unsigned int)(h ^ (h >> 7) ^ (h >> 13));
+	for (n = 0; n < _ARC4RANDOM_POOL; n++, i++) {
+		i %= _ARC4RANDOM_POOL;
+		if (!__atomic_load_n(&_arc4random_data[i].busy,
+		    __ATOMIC_RELAXED) &&
+		    !__atomic_exchange_n(&_arc4random_data[i].busy, 1,
+		    __ATOMIC_ACQUIRE))
+			return &_arc4random_data[i].a;
+	}
+	_ARC4_LOCK();
+	return &_arc4random_data[_ARC4RANDOM_POOL].a;
+}
+
+static inline void
+_arc4_release(struct _arc4 *a)
+{
+	if (a == &_arc4random_data[_ARC4RANDOM_POOL].a)
+		_ARC4_UNLOCK();
+	else
+		__atomic_store_n(&((struct _arc4random_slot *)a)->busy, 0,
+		    __ATOMIC_RELEASE);
+}
+#else
+static struct _arc4 _arc4;
 
+static inline struct _arc4 *
+_arc4_acquire(void)
+{
 #ifndef __SINGLE_THREAD__
 	_ARC4_LOCK();
 #endif
-	_rs_random_u32(&val);
+	return &_arc4;
+}
+
+static inline void
+_arc4_release(struct _arc4 *a)
+{
 #ifndef __SINGLE_THREAD__
 	_ARC4_UNLOCK();
 #endif
+}
+#endif /* _ARC4RANDOM_POOL */
+
+uint32_t
+arc4random(void)
+{
+	struct _arc4 *a;
+	uint32_t val;
+
+	a = _arc4_acquire();
+	_rs_random_u32(a, &val);
+	_arc4_release(a);
 	return val;
 }
 
 void
 arc4random_buf(void *buf, size_t n)
 {
-#ifndef __SINGLE_THREAD__
-	_ARC4_LOCK();
-#endif
-	_rs_random_buf(buf, n);
-#ifndef __SINGLE_THREAD__
-	_ARC4_UNLOCK();
-#endif
+	struct _arc4 *a;
+
+	a = _arc4_acquire();
+	_rs_random_buf(a, buf, n);
+	_arc4_release(a);
 }
@@ -31,12 +31,26 @@
  *  o _ARC4RANDOM_GETENTROPY_FAIL(),
  *  o _ARC4RANDOM_ALLOCATE(rsp, rspx), and
  *  o _ARC4RANDOM_FORKDETECT().
+ *
+ * Without a port specific lock, data or allocation, multi-threaded builds
+ * which favour speed use _ARC4RANDOM_POOL generators instead of a single
+ * one under a global lock.  Callers take a free one with an atomic
+ * exchange, so concurrent threads rarely wait for each other.  When all
+ * of them are busy, callers share one more generator under the lock
+ * rather than spin on threads which may have been preempted.
  */
 #include <machine/_arc4random.h>
 
 #include <sys/lock.h>
 #include <signal.h>
 
+#if !defined(_ARC4_LOCK_INIT) && !defined(_ARC4RANDOM_DATA) && \
+    !defined(_ARC4RANDOM_ALLOCATE) && !defined(__SINGLE_THREAD__) && \
+    defined(__GNUC__) && !defined(PREFER_SIZE_OVER_SPEED) && \
+    !defined(__OPTIMIZE_SIZE__)
+#define _ARC4RANDOM_POOL 8
+#endif
+
 #ifndef _ARC4_LOCK_INIT
 
 #define _ARC4_LOCK_INIT __LOCK_INIT(static, __arc4random_mutex);
@@ -53,6 +67,13 @@ _ARC4_LOCK_INIT
 
 #ifdef _ARC4RANDOM_DATA
 _ARC4RANDOM_DATA
+#elif defined(_ARC4RANDOM_POOL)
+static struct _arc4random_slot {
+	struct _arc4 a;		/* first, see _arc4_release() */
+	int busy;
+	struct _rs rs;
+	struct _rsx rsx;
+} _arc4random_data[_ARC4RANDOM_POOL + 1];	/* the last under the lock */
 #else
 static struct {
 	struct _rs rs;
@@ -71,13 +92,19 @@ _getentropy_fail(void)
 }
 
 static inline int
-_rs_allocate(struct _rs **rsp, struct _rsx **rsxp)
+_rs_allocate(struct _arc4 *a)
 {
 #ifdef _ARC4RANDOM_ALLOCATE
-	_ARC4RANDOM_ALLOCATE(rsp, rsxp);
+	_ARC4RANDOM_ALLOCATE(&a->rs, &a->rsx);
+#elif defined(_ARC4RANDOM_POOL)
+	struct _arc4random_slot *slot = (struct _arc4random_slot *)a;
+
+	a->rs = &slot->rs;
+	a->rsx = &slot->rsx;
+	return (0);
 #else
-	*rsp = &_arc4random_data.rs;
-	*rsxp = &_arc4random_data.rsx;
+	a->rs = &_arc4random_data.rs;
+	a->rsx = &_arc4random_data.rsx;
 	return (0);
 #endif
 }
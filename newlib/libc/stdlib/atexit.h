@@ -12,3 +12,12 @@ enum __atexit_types
 void __call_exitprocs (int, void *);
 int __register_exitproc (int, void (*fn) (void), void *, void *);
 
+/* Handler blocks are only allocated dynamically when the port provides
+   malloc.  Then also index the handlers by DSO handle, so that
+   __cxa_finalize does not have to walk the handlers of every other DSO.  */
+#if defined (_ATEXIT_DYNAMIC_ALLOC) && defined (MALLOC_PROVIDED) \
+    && !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+#define _ATEXIT_DSO_INDEX
+void __atexit_dso_add (struct _atexit *, int, void *);
+#endif
+
@@ -55,6 +55,7 @@ permit '=' to be in identifiers.
 #include <stddef.h>
 #include <string.h>
 #include "envlock.h"
+#include "local.h"
 
 extern char **environ;
 
@@ -63,6 +64,147 @@ extern char **environ;
    'environ'.  */
 static char ***p_environ = &environ;
 
+#ifdef _ENV_INDEX
+/*
+ * Open addressing hash table of the names in environ, used and changed
+ * only with ENV_LOCK held.  The index is only used while it was built for
+ * the current environ array and that array still ends where it did, and
+ * every hit is checked against the entry itself.  setenv and unsetenv
+ * keep the index up to date; when user code replaces or extends environ
+ * directly, the index is rebuilt on the next lookup.  Entries stored into
+ * the existing array by user code aren't noticed.
+ */
+struct env_index
+{
+  char **environ;		/* array indexed */
+  int count;			/* number of entries in it */
+  int mask;			/* number of slots - 1 */
+  struct
+  {
+    unsigned int hash;
+    int offset;			/* -1 for an empty slot */
+  } slot[1];
+};
+
+static struct env_index *env_index;
+
+static unsigned int
+env_hash (const char *name,
+	int *len)
+{
+  unsigned int h = 2166136261U;
+  const char *c;
+
+  for (c = name; *c && *c != '='; c++)
+    h = (h ^ (unsigned char) *c) * 16777619U;
+  *len = c - name;
+  return h;
+}
+
+static int
+env_index_lookup (struct env_index *idx,
+	char **env,
+	const char *name,
+	int len,
+	unsigned int h)
+{
+  int i, offset;
+
+  for (i = h & idx->mask; (offset = idx->slot[i].offset) >= 0;
+       i = (i + 1) & idx->mask)
+    if (idx->slot[i].hash == h && env[offset]
+	&& !strncmp (env[offset], name, len) && env[offset][len] == '=')
+      return offset;
+  return -1;
+}
+
+static void
+env_index_add (struct env_index *idx,
+	char **env,
+	int offset)
+{
+  int len;
+  unsigned int h = env_hash (env[offset], &len);
+  int i;
+
+  /* Only the first of several entries with the same name is found.  */
+  if (env_index_lookup (idx, env, env[offset], len, h) >= 0)
+    return;
+  for (i = h & idx->mask; idx->slot[i].offset >= 0; i = (i + 1) & idx->mask)
+    ;
+  idx->slot[i].hash = h;
+  idx->slot[i].offset = offset;
+}
+
+/* Build the index for the current environ, reusing the table if it is
+   big enough.  Called with ENV_LOCK held.  */
+static struct env_index *
+env_index_build (struct _reent *reent_ptr)
+{
+  struct env_index *idx = env_index;
+  char **env = *p_environ;
+  int cnt, slots, i;
+
+  for (cnt = 0; env[cnt]; cnt++)
+    ;
+  for (slots = 64; slots < 2 * cnt + 2; slots *= 2)
+    ;
+  if (idx == NULL || idx->mask + 1 < slots)
+    {
+      if (idx != NULL)
+	_free_r (reent_ptr, idx);
+      env_index = idx = (struct env_index *)
+	_malloc_r (reent_ptr,
+		   sizeof (*idx) + (slots - 1) * sizeof (idx->slot[0]));
+      if (idx == NULL)
+	return NULL;
+      idx->mask = slots - 1;
+    }
+  for (i = 0; i <= idx->mask; i++)
+    idx->slot[i].offset = -1;
+  for (i = 0; i < cnt; i++)
+    env_index_add (idx, env, i);
+  idx->count = cnt;
+  idx->environ = env;
+  return idx;
+}
+
+/*
+ * __env_index_insert --
+ *	Entry 'offset' has been appended to environ.  Called with ENV_LOCK
+ *	held.
+ */
+void
+__env_index_insert (int offset)
+{
+  struct env_index *idx = env_index;
+  char **env = *p_environ;
+
+  /* A stale index is rebuilt on the next lookup; one that would become
+     too full is grown then, too.  */
+  if (idx == NULL || idx->count != offset || 2 * offset + 2 > idx->mask + 1)
+    {
+      __env_index_invalidate ();
+      return;
+    }
+  env_index_add (idx, env, offset);
+  idx->count = offset + 1;
+  idx->environ = env;
+}
+
+/*
+ * __env_index_invalidate --
+ *	Entries of environ have been removed or moved.  Called with ENV_LOCK
+ *	held.
+ */
+void
+__env_index_invalidate (void)
+{
+  if (env_index)
+    env_index->environ = NULL;
+}
+#endif /* _ENV_INDEX */
+
 /*
  * _findenv --
  *	Returns pointer to value associated with name, if any, else NULL.
@@ -81,6 +223,41 @@ _findenv_r (struct _reent *reent_ptr,
   register char **p;
   const char *c;
 
+#ifdef _ENV_INDEX
+  struct env_index *idx;
+  char **env;
+  unsigned int h;
+  int i, n;
+
+  h = env_hash (name, &n);
+  /* Identifiers may not contain an '=', so cannot match if does */
+  if (name[n] == '=')
+    return NULL;
+
+  ENV_LOCK;
+
+  env = *p_environ;
+  if (!env)
+    {
+      ENV_UNLOCK;
+      return NULL;
+    }
+
+  idx = env_index;
+  if (idx == NULL || idx->environ != env || env[idx->count] != NULL)
+    idx = env_index_build (reent_ptr);
+  if (idx != NULL)
+    {
+      i = env_index_lookup (idx, env, name, n, h);
+      ENV_UNLOCK;
+      if (i < 0)
+	return NULL;
+      *offset = i;
+      return env[i] + n + 1;
+    }
+  ENV_UNLOCK;
+#endif
+
   ENV_LOCK;
 
   /* In some embedded systems, this does not get set.  This protects
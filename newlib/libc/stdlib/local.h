@@ -27,6 +27,7 @@ wctomb_f __gbk_wctomb;
 wctomb_f __kr_wctomb;
 wctomb_f __big5_wctomb;
 #endif
+size_t __wcsnrtombs_fast (char *, const wchar_t **, size_t, size_t, int);
 #endif
 
 #define __WCTOMB (__get_current_locale ()->wctomb)
@@ -48,6 +49,7 @@ mbtowc_f __gbk_mbtowc;
 mbtowc_f __kr_mbtowc;
 mbtowc_f __big5_mbtowc;
 #endif
+size_t __mbsnrtowcs_fast (wchar_t *, const char **, size_t, size_t, int);
 #endif
 
 #define __MBTOWC (__get_current_locale ()->mbtowc)
@@ -60,4 +62,12 @@ extern wchar_t __cp_conv[][0x80];
 int __cp_val_index (int);
 int __cp_index (const char *);
 
+/* getenv_r.c keeps a hash index of environ, used with ENV_LOCK held.
+   setenv_r.c reports changes to it. */
+#if !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+#define _ENV_INDEX
+void __env_index_insert (int);
+void __env_index_invalidate (void);
+#endif
+
 #endif
@@ -69,6 +69,7 @@ PORTABILITY
 #include <stdlib.h>
 #include <stdio.h>
 #include <errno.h>
+#include "local.h"
 
 size_t
 _mbsnrtowcs_r (struct _reent *r,
@@ -83,6 +84,12 @@ _mbsnrtowcs_r (struct _reent *r,
   size_t max;
   size_t count = 0;
   int bytes;
+#if defined (_MB_CAPABLE) \
+    && !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+  mbtowc_p conv = __MBTOWC;
+  const char *start;
+  size_t n;
+#endif
 
 #ifdef _MB_CAPABLE
   if (ps == NULL)
@@ -104,6 +111,25 @@ _mbsnrtowcs_r (struct _reent *r,
   max = len;
   while (len > 0)
     {
+#if defined (_MB_CAPABLE) \
+    && !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+      /* Convert runs of plain characters in bulk and leave the rest,
+	 including the terminating NUL, to the locale's mbtowc. */
+      if (ps->__count == 0
+	  && (conv == __utf8_mbtowc || conv == __ascii_mbtowc))
+	{
+	  start = *src;
+	  n = __mbsnrtowcs_fast (ptr, src, nms, len,
+				 conv == __utf8_mbtowc);
+	  nms -= *src - start;
+	  count += n;
+	  len -= n;
+	  if (dst != NULL)
+	    ptr += n;
+	  if (len == 0)
+	    break;
+	}
+#endif
       bytes = _mbrtowc_r (r, ptr, *src, nms, ps);
       if (bytes > 0)
 	{
@@ -10,13 +10,37 @@ _mbstowcs_r (struct _reent *r,
         mbstate_t     *state)
 {
   size_t ret = 0;
-  char *t = (char *)s;
+  const char *t = s;
   int bytes;
+#if defined (_MB_CAPABLE) \
+    && !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+  mbtowc_p conv = __MBTOWC;
+  size_t count;
+#endif
 
   if (!pwcs)
     n = (size_t) 1; /* Value doesn't matter as long as it's not 0. */
   while (n > 0)
     {
+#if defined (_MB_CAPABLE) \
+    && !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+      /* Convert runs of plain characters in bulk; see mbsnrtowcs.c. */
+      if (state->__count == 0
+	  && (conv == __utf8_mbtowc || conv == __ascii_mbtowc))
+	{
+	  count = __mbsnrtowcs_fast (pwcs, &t, (size_t) -1,
+				     pwcs ? n : (size_t) -1,
+				     conv == __utf8_mbtowc);
+	  ret += count;
+	  if (pwcs)
+	    {
+	      pwcs += count;
+	      n -= count;
+	      if (n == 0)
+		break;
+	    }
+	}
+#endif
       bytes = __MBTOWC (r, pwcs, t, MB_CUR_MAX, state);
       if (bytes < 0)
 	{
@@ -723,6 +723,94 @@ __utf8_mbtowc (struct _reent *r,
   return -1;
 }
 
+#if !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+/* Nonzero if any byte of X is zero or has its high bit set.  */
+#define NOT_PLAIN_ASCII(X) \
+  ((((X) - (~0UL / 0xff)) | (X)) & (~0UL / 0xff * 0x80))
+
+/* Bulk conversion for _mbsnrtowcs_r and _mbstowcs_r in the ASCII and
+   UTF-8 charsets, called with an initial conversion state.  Converts at
+   most LEN characters from the NMS bytes at *SRC and advances *SRC past
+   them; DST may be NULL to count only.  It stops in front of anything
+   the per-character conversion has to decide on: a NUL byte, a byte
+   outside ASCII if UTF8 is zero, and an invalid, truncated or (with
+   16 bit wchar_t) supplementary UTF-8 sequence.  Returns the number of
+   characters converted. */
+size_t
+__mbsnrtowcs_fast (wchar_t *dst,
+        const char   **src,
+        size_t         nms,
+        size_t         len,
+        int            utf8)
+{
+  const unsigned char *t = (const unsigned char *) *src;
+  size_t count = 0;
+  size_t i;
+  wint_t ch;
+
+  while (count < len && nms > 0)
+    {
+      /* Copy ASCII a word at a time. */
+      while (nms >= sizeof (unsigned long)
+	     && len - count >= sizeof (unsigned long)
+	     && ((size_t) t & (sizeof (unsigned long) - 1)) == 0
+	     && !NOT_PLAIN_ASCII (*(const unsigned long *) t))
+	{
+	  if (dst)
+	    for (i = 0; i < sizeof (unsigned long); ++i)
+	      *dst++ = t[i];
+	  t += sizeof (unsigned long);
+	  nms -= sizeof (unsigned long);
+	  count += sizeof (unsigned long);
+	}
+      if (count >= len || nms == 0)
+	break;
+
+      ch = *t;
+      if (ch == '\0')
+	break;
+      if (ch <= 0x7f)
+	i = 1;
+      else if (!utf8)
+	break;
+      else if (ch >= 0xc2 && ch <= 0xdf)
+	{
+	  if (nms < 2 || (t[1] & 0xc0) != 0x80)
+	    break;
+	  ch = (ch & 0x1f) << 6 | (t[1] & 0x3f);
+	  i = 2;
+	}
+      else if (ch >= 0xe0 && ch <= 0xef)
+	{
+	  if (nms < 3 || (t[1] & 0xc0) != 0x80 || (t[2] & 0xc0) != 0x80
+	      || (ch == 0xe0 && t[1] < 0xa0))
+	    break;
+	  ch = (ch & 0x0f) << 12 | (t[1] & 0x3f) << 6 | (t[2] & 0x3f);
+	  i = 3;
+	}
+      else if (ch >= 0xf0 && ch <= 0xf4 && sizeof (wchar_t) > 2)
+	{
+	  if (nms < 4 || (t[1] & 0xc0) != 0x80 || (t[2] & 0xc0) != 0x80
+	      || (t[3] & 0xc0) != 0x80 || (ch == 0xf0 && t[1] < 0x90)
+	      || (ch == 0xf4 && t[1] >= 0x90))
+	    break;
+	  ch = (ch & 0x07) << 18 | (t[1] & 0x3f) << 12 | (t[2] & 0x3f) << 6
+	       | (t[3] & 0x3f);
+	  i = 4;
+	}
+      else
+	break;
+      if (dst)
+	*dst++ = (wchar_t) ch;
+      t += i;
+      nms -= i;
+      ++count;
+    }
+  *src = (const char *) t;
+  return count;
+}
+#endif /* !PREFER_SIZE_OVER_SPEED && !__OPTIMIZE_SIZE__ */
+
 /* Cygwin defines its own doublebyte charset conversion functions 
    because the underlying OS requires wchar_t == UTF-16. */
 #ifndef  __CYGWIN__
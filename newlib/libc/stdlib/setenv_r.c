@@ -28,6 +28,7 @@
 #include <time.h>
 #include <errno.h>
 #include "envlock.h"
+#include "local.h"
 
 extern char **environ;
 
@@ -54,6 +55,11 @@ _setenv_r (struct _reent *reent_ptr,
 	int rewrite)
 {
   static int alloced;		/* if allocated space before */
+#ifdef _ENV_INDEX
+  static char **env_array;	/* array allocated last */
+  static int env_size;		/* and its number of entries */
+  int added = 0;
+#endif
   register char *C;
   int l_value, offset;
 
@@ -86,6 +92,23 @@ _setenv_r (struct _reent *reent_ptr,
       register char **P;
 
       for (P = *p_environ, cnt = 0; *P; ++P, ++cnt);
+#ifdef _ENV_INDEX
+      /* Grow the array geometrically instead of by one entry.  */
+      if (alloced && *p_environ == env_array && cnt + 2 <= env_size)
+	;			/* still room */
+      else if (alloced)
+	{
+	  env_size = 2 * cnt + 2;
+	  *p_environ = (char **) _realloc_r (reent_ptr, (char *) environ,
+					     (size_t) (sizeof (char *) * env_size));
+	  if (!*p_environ)
+            {
+              ENV_UNLOCK;
+	      return -1;
+            }
+	  env_array = *p_environ;
+	}
+#else
       if (alloced)
 	{			/* just increase size */
 	  *p_environ = (char **) _realloc_r (reent_ptr, (char *) environ,
@@ -96,6 +119,7 @@ _setenv_r (struct _reent *reent_ptr,
 	      return -1;
             }
 	}
+#endif
       else
 	{			/* get new space */
 	  alloced = 1;		/* copy old entries into it */
@@ -107,9 +131,16 @@ _setenv_r (struct _reent *reent_ptr,
             }
 	  memcpy((char *) P,(char *) *p_environ, cnt * sizeof (char *));
 	  *p_environ = P;
+#ifdef _ENV_INDEX
+	  env_array = P;
+	  env_size = cnt + 2;
+#endif
 	}
       (*p_environ)[cnt + 1] = NULL;
       offset = cnt;
+#ifdef _ENV_INDEX
+      added = 1;
+#endif
     }
   for (C = (char *) name; *C && *C != '='; ++C);	/* no `=' in name */
   if (!((*p_environ)[offset] =	/* name + `=' + value */
@@ -121,6 +152,10 @@ _setenv_r (struct _reent *reent_ptr,
   for (C = (*p_environ)[offset]; (*C = *name++) && *C != '='; ++C);
   for (*C++ = '='; (*C++ = *value++) != 0;);
 
+#ifdef _ENV_INDEX
+  if (added)
+    __env_index_insert (offset);
+#endif
   ENV_UNLOCK;
 
   return 0;
@@ -151,6 +186,9 @@ _unsetenv_r (struct _reent *reent_ptr,
       for (P = &(*p_environ)[offset];; ++P)
         if (!(*P = *(P + 1)))
 	  break;
+#ifdef _ENV_INDEX
+      __env_index_invalidate ();
+#endif
     }
 
   ENV_UNLOCK;
@@ -78,9 +78,14 @@ _wcsnrtombs_l (struct _reent *r, char *dst, const wchar_t **src, size_t nwc,
 {
   char *ptr = dst;
   char buff[10];
-  wchar_t *pwcs;
+  const wchar_t *pwcs;
   size_t n;
   int i;
+#if defined (_MB_CAPABLE) \
+    && !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+  const wchar_t *start;
+  size_t k;
+#endif
 
 #ifdef _MB_CAPABLE
   if (ps == NULL)
@@ -95,13 +100,38 @@ _wcsnrtombs_l (struct _reent *r, char *dst, const wchar_t **src, size_t nwc,
     len = (size_t)-1;
 
   n = 0;
-  pwcs = (wchar_t *)(*src);
+  pwcs = *src;
 
-  while (n < len && nwc-- > 0)
+  while (n < len && nwc > 0)
     {
-      int count = ps->__count;
-      wint_t wch = ps->__value.__wch;
-      int bytes = loc->wctomb (r, buff, *pwcs, ps);
+      int count, bytes;
+      wint_t wch;
+
+#if defined (_MB_CAPABLE) \
+    && !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+      /* Convert runs of plain characters in bulk and leave the rest,
+	 including the terminating NUL, to the locale's wctomb. */
+      if (ps->__count == 0
+	  && (loc->wctomb == __utf8_wctomb || loc->wctomb == __ascii_wctomb))
+	{
+	  start = pwcs;
+	  k = __wcsnrtombs_fast (ptr, &pwcs, nwc, len - n,
+				 loc->wctomb == __utf8_wctomb);
+	  n += k;
+	  nwc -= pwcs - start;
+	  if (dst)
+	    {
+	      ptr += k;
+	      *src = pwcs;
+	    }
+	  if (n >= len || nwc == 0)
+	    break;
+	}
+#endif
+      count = ps->__count;
+      wch = ps->__value.__wch;
+      bytes = loc->wctomb (r, buff, *pwcs, ps);
+      --nwc;
       if (bytes == -1)
 	{
 	  r->_errno = EILSEQ;
@@ -13,12 +13,32 @@ _wcstombs_r (struct _reent *r,
   size_t max = n;
   char buff[8];
   int i, bytes, num_to_copy;
+#if defined (_MB_CAPABLE) \
+    && !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+  wctomb_p conv = __WCTOMB;
+  int fast;
+  size_t count;
+
+  /* Convert runs of plain characters in bulk; see wcsnrtombs.c. */
+  fast = (conv == __utf8_wctomb || conv == __ascii_wctomb);
+#endif
 
   if (s == NULL)
     {
       size_t num_bytes = 0;
       while (*pwcs != 0)
 	{
+#if defined (_MB_CAPABLE) \
+    && !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+	  if (fast && state->__count == 0)
+	    {
+	      num_bytes += __wcsnrtombs_fast (NULL, (const wchar_t **) &pwcs,
+					      (size_t) -1, (size_t) -1,
+					      conv == __utf8_wctomb);
+	      if (*pwcs == 0)
+		break;
+	    }
+#endif
 	  bytes = __WCTOMB (r, buff, *pwcs++, state);
 	  if (bytes == -1)
 	    return -1;
@@ -30,6 +50,18 @@ _wcstombs_r (struct _reent *r,
     {
       while (n > 0)
         {
+#if defined (_MB_CAPABLE) \
+    && !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+	  if (fast && state->__count == 0)
+	    {
+	      count = __wcsnrtombs_fast (ptr, (const wchar_t **) &pwcs,
+					 (size_t) -1, n, conv == __utf8_wctomb);
+	      ptr += count;
+	      n -= count;
+	      if (n == 0)
+		break;
+	    }
+#endif
           bytes = __WCTOMB (r, buff, *pwcs, state);
           if (bytes == -1)
             return -1;
@@ -137,6 +137,82 @@ __utf8_wctomb (struct _reent *r,
   return -1;
 }
 
+#if !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+/* Bulk conversion for _wcsnrtombs_l and _wcstombs_r in the ASCII and
+   UTF-8 charsets, called with an initial conversion state.  Converts
+   at most NWC characters from *SRC into at most LEN bytes and advances
+   *SRC past them; DST may be NULL to count only.  It stops in front of
+   anything the per-character conversion has to decide on: a NUL, a
+   character outside ASCII if UTF8 is zero, a surrogate, a value beyond
+   U+10FFFF, and a character which does not fit into the remaining
+   space.  Returns the number of bytes stored. */
+size_t
+__wcsnrtombs_fast (char *dst,
+        const wchar_t **src,
+        size_t          nwc,
+        size_t          len,
+        int             utf8)
+{
+  const wchar_t *pwcs = *src;
+  unsigned char *s = (unsigned char *) dst;
+  size_t n = 0;
+  size_t wchar;
+
+  for (; nwc > 0; --nwc, ++pwcs)
+    {
+      wchar = *pwcs;
+      if (wchar - 1 < 0x7f)
+	{
+	  if (n >= len)
+	    break;
+	  if (s)
+	    *s++ = wchar;
+	  n += 1;
+	}
+      else if (!utf8 || wchar == 0)
+	break;
+      else if (wchar <= 0x7ff)
+	{
+	  if (len - n < 2)
+	    break;
+	  if (s)
+	    {
+	      *s++ = 0xc0 | (wchar >> 6);
+	      *s++ = 0x80 | (wchar & 0x3f);
+	    }
+	  n += 2;
+	}
+      else if (wchar <= 0xffff)
+	{
+	  if ((wchar >= 0xd800 && wchar <= 0xdfff) || len - n < 3)
+	    break;
+	  if (s)
+	    {
+	      *s++ = 0xe0 | (wchar >> 12);
+	      *s++ = 0x80 | ((wchar >> 6) & 0x3f);
+	      *s++ = 0x80 | (wchar & 0x3f);
+	    }
+	  n += 3;
+	}
+      else
+	{
+	  if (wchar > 0x10ffff || len - n < 4)
+	    break;
+	  if (s)
+	    {
+	      *s++ = 0xf0 | (wchar >> 18);
+	      *s++ = 0x80 | ((wchar >> 12) & 0x3f);
+	      *s++ = 0x80 | ((wchar >> 6) & 0x3f);
+	      *s++ = 0x80 | (wchar & 0x3f);
+	    }
+	  n += 4;
+	}
+    }
+  *src = pwcs;
+  return n;
+}
+#endif /* !PREFER_SIZE_OVER_SPEED && !__OPTIMIZE_SIZE__ */
+
 /* Cygwin defines its own doublebyte charset conversion functions 
    because the underlying OS requires wchar_t == UTF-16. */
 #ifndef __CYGWIN__
@@ -96,6 +96,15 @@ PORTABILITY
 #include "local.h"
 
 #ifdef _MB_CAPABLE
+#if !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+/* Three-stage table generated by mkunidata from ambiguous.t,
+   combining.t and wide.t, about 11 KiB; each entry combines the
+   following flags. */
+#define WIDTH_AMBIGUOUS	1
+#define WIDTH_COMBINING	2
+#define WIDTH_WIDE	4
+#include "wcwidth_trie.t"
+#else
 struct interval
 {
   int first;
@@ -124,6 +133,7 @@ bisearch(wint_t ucs, const struct interval *table, int max)
 
   return 0;
 }
+#endif
 #endif /* _MB_CAPABLE */
 
 /* The following function defines the column width of an ISO 10646
@@ -167,6 +177,7 @@ int
 __wcwidth (const wint_t ucs)
 {
 #ifdef _MB_CAPABLE
+#if defined (PREFER_SIZE_OVER_SPEED) || defined (__OPTIMIZE_SIZE__)
   /* sorted list of non-overlapping intervals of East Asian Ambiguous chars */
   static const struct interval ambiguous[] =
 #include "ambiguous.t"
@@ -180,6 +191,7 @@ __wcwidth (const wint_t ucs)
    */
   static const struct interval wide[] =
 #include "wide.t"
+#endif
 
   /* Test for NUL character */
   if (ucs == 0)
@@ -200,6 +212,18 @@ __wcwidth (const wint_t ucs)
   /* check CJK width mode (1: ambiguous-wide, 0: normal, -1: disabled) */
   int cjk_lang = __locale_cjk_lang ();
 
+#if !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+  int width = ucs < WCWIDTH_TRIE_LIMIT ? wcwidth_trie(ucs) : 0;
+
+  if (cjk_lang > 0 && (width & WIDTH_AMBIGUOUS))
+    return 2;
+  if (width & WIDTH_COMBINING)
+    return 0;
+  if (cjk_lang >= 0 && (width & WIDTH_WIDE))
+    return 2;
+  else
+    return 1;
+#else
   /* binary search in table of ambiguous characters */
   if (cjk_lang > 0
       && bisearch(ucs, ambiguous,
@@ -220,6 +244,7 @@ __wcwidth (const wint_t ucs)
     return 2;
   else
     return 1;
+#endif
 #else /* !_MB_CAPABLE */
   if (iswprint (ucs))
     return 1;
@@ -24,6 +24,7 @@
 
 #include <dirent.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <ftw.h>
 #include <search.h>
 #include <stdlib.h>
@@ -31,9 +32,22 @@
 #include <unistd.h>
 #include <sys/param.h>
 #include <sys/stat.h>
+#include <machine/syscall.h>
 
 extern struct dirent64 *__readdir64 (DIR *);
 
+/* With the *at system calls entries are looked up relative to the
+   directory being read instead of by their full name.  */
+#ifdef __NR_openat
+extern int __libc_openat (int, const char *, int, mode_t);
+#endif
+#ifdef __NR_fstatat64
+extern int __libc_fstatat64 (int, const char *, struct stat64 *, int);
+#endif
+#ifndef AT_SYMLINK_NOFOLLOW
+# define AT_SYMLINK_NOFOLLOW 0x100
+#endif
+
 /* #define NDEBUG 1 */
 #include <assert.h>
 
@@ -95,6 +109,9 @@ struct ftw_data
   /* Data structure for keeping fingerprints of already processed
      object.  This is needed when not using FTW_PHYS.  */
   void *known_objects;
+
+  /* Nonzero until the kernel turned out not to have the *at calls.  */
+  int use_at;
 };
 
 
@@ -113,7 +130,8 @@ static const int ftw_arr[] =
 
 
 /* Forward declarations of local functions.  */
-static int ftw_dir (struct ftw_data *data, struct STAT *st);
+static int ftw_dir (struct ftw_data *data, struct STAT *st,
+		    struct dir_data *parent);
 
 
 static int
@@ -151,8 +169,11 @@ find_object (struct ftw_data *data, struct STAT *st)
 }
 
 
+/* Open the directory named in data->dirbuf, an entry of PARENT unless
+   that is NULL.  */
 static inline int
-open_dir_stream (struct ftw_data *data, struct dir_data *dirp)
+open_dir_stream (struct ftw_data *data, struct dir_data *dirp,
+		 struct dir_data *parent)
 {
   int result = 0;
 
@@ -160,7 +181,8 @@ open_dir_stream (struct ftw_data *data, struct dir_data *dirp)
     {
       /* Oh, oh.  We must close this stream.  Get all remaining
 	 entries and store them as a list in the `content' member of
-	 the `struct dir_data' variable.  */
+	 the `struct dir_data' variable.  Each name is followed by its
+	 NUL byte and the d_type of the entry.  */
       size_t bufsize = 1024;
       char *buf = malloc (bufsize);
 
@@ -175,7 +197,7 @@ open_dir_stream (struct ftw_data *data, struct dir_data *dirp)
 	  while ((d = __readdir64 (st)) != NULL)
 	    {
 	      size_t this_len = strlen (d->d_name);
-	      if (actsize + this_len + 2 >= bufsize)
+	      if (actsize + this_len + 3 >= bufsize)
 		{
 		  char *newp;
 		  bufsize += MAX (1024, 2 * this_len);
@@ -194,7 +216,8 @@ open_dir_stream (struct ftw_data *data, struct dir_data *dirp)
 
 	      *((char *) mempcpy (buf + actsize, d->d_name, this_len))
 		= '\0';
-	      actsize += this_len + 1;
+	      buf[actsize + this_len + 1] = d->d_type;
+	      actsize += this_len + 2;
 	    }
 
 	  /* Terminate the list with an additional NUL byte.  */
@@ -223,7 +246,33 @@ open_dir_stream (struct ftw_data *data, struct dir_data *dirp)
     {
       assert (data->dirstreams[data->actdir] == NULL);
 
-      dirp->stream = opendir (data->dirbuf);
+      dirp->stream = NULL;
+#ifdef __NR_openat
+      /* Look the directory up in its parent if that is still open.  */
+      if (data->use_at && parent != NULL && parent->stream != NULL)
+	{
+	  int fd = __libc_openat (dirfd (parent->stream),
+				  data->dirbuf + data->ftw.base,
+				  O_RDONLY | O_DIRECTORY, 0);
+	  if (fd >= 0)
+	    {
+	      dirp->stream = fdopendir (fd);
+	      if (dirp->stream == NULL)
+		{
+		  int save_err = errno;
+		  close (fd);
+		  __set_errno (save_err);
+		  return -1;
+		}
+	    }
+	  else if (errno == ENOSYS)
+	    data->use_at = 0;
+	  else
+	    return -1;
+	}
+#endif
+      if (dirp->stream == NULL)
+	dirp->stream = opendir (data->dirbuf);
       if (dirp->stream == NULL)
 	result = -1;
       else
@@ -240,9 +289,30 @@ open_dir_stream (struct ftw_data *data, struct dir_data *dirp)
 }
 
 
+/* Stat the entry NAME of DIR, whose full name is in data->dirbuf.  */
+static inline int
+entry_stat (struct ftw_data *data, struct dir_data *dir, const char *name,
+	    int nofollow, struct STAT *st)
+{
+#if defined FSTATAT && defined __NR_fstatat64
+  if (data->use_at && dir->stream != NULL)
+    {
+      if (FSTATAT (dirfd (dir->stream), name, st,
+		   nofollow ? AT_SYMLINK_NOFOLLOW : 0) == 0)
+	return 0;
+      if (errno != ENOSYS)
+	return -1;
+      data->use_at = 0;
+    }
+#endif
+
+  return nofollow ? LXSTAT (data->dirbuf, st) : XSTAT (data->dirbuf, st);
+}
+
+
 static inline int
 process_entry (struct ftw_data *data, struct dir_data *dir, const char *name,
-	       size_t namlen)
+	       size_t namlen, unsigned char d_type)
 {
   struct STAT st;
   int result = 0;
@@ -267,14 +337,15 @@ process_entry (struct ftw_data *data, struct dir_data *dir, const char *name,
 
   *((char *) mempcpy (data->dirbuf + data->ftw.base, name, namlen)) = '\0';
 
-  if (((data->flags & FTW_PHYS)
-       ? LXSTAT (data->dirbuf, &st)
-       : XSTAT (data->dirbuf, &st)) < 0)
+  if (entry_stat (data, dir, name, data->flags & FTW_PHYS, &st) < 0)
     {
+      /* Only a symbolic link can be dangling, so when the kernel told
+	 us the type there is no need to look at the link itself.  */
       if (errno != EACCES && errno != ENOENT)
 	result = -1;
       else if (!(data->flags & FTW_PHYS)
-	       && LXSTAT (data->dirbuf, &st) == 0
+	       && (d_type == DT_UNKNOWN || d_type == DT_LNK)
+	       && entry_stat (data, dir, name, 1, &st) == 0
 	       && S_ISLNK (st.st_mode))
 	flag = FTW_SLN;
       else
@@ -301,7 +372,7 @@ process_entry (struct ftw_data *data, struct dir_data *dir, const char *name,
 		  /* Remember the object.  */
 		  && (result = add_object (data, &st)) == 0))
 	    {
-	      result = ftw_dir (data, &st);
+	      result = ftw_dir (data, &st, dir);
 
 	      if (result == 0 && (data->flags & FTW_CHDIR))
 		{
@@ -342,7 +413,7 @@ process_entry (struct ftw_data *data, struct dir_data *dir, const char *name,
 
 
 static int
-ftw_dir (struct ftw_data *data, struct STAT *st)
+ftw_dir (struct ftw_data *data, struct STAT *st, struct dir_data *parent)
 {
   struct dir_data dir;
   struct dirent64 *d;
@@ -352,7 +423,7 @@ ftw_dir (struct ftw_data *data, struct STAT *st)
 
   /* Open the stream for this directory.  This might require that
      another stream has to be closed.  */
-  result = open_dir_stream (data, &dir);
+  result = open_dir_stream (data, &dir, parent);
   if (result != 0)
     {
       if (errno == EACCES)
@@ -409,7 +480,8 @@ ftw_dir (struct ftw_data *data, struct STAT *st)
 
   while (dir.stream != NULL && (d = __readdir64 (dir.stream)) != NULL)
     {
-      result = process_entry (data, &dir, d->d_name, strlen (d->d_name));
+      result = process_entry (data, &dir, d->d_name, strlen (d->d_name),
+			      d->d_type);
       if (result != 0)
 	break;
     }
@@ -438,9 +510,9 @@ ftw_dir (struct ftw_data *data, struct STAT *st)
 	{
 	  char *endp = strchr (runp, '\0');
 
-	  result = process_entry (data, &dir, runp, endp - runp);
+	  result = process_entry (data, &dir, runp, endp - runp, endp[1]);
 
-	  runp = endp + 1;
+	  runp = endp + 2;
 	}
 
       save_err = errno;
@@ -528,6 +600,8 @@ ftw_startup (const char *dir, int is_nftw, void *func, int descriptors,
   /* No object known so far.  */
   data.known_objects = NULL;
 
+  data.use_at = 1;
+
   /* Now go to the directory containing the initial file/directory.  */
   if ((flags & FTW_CHDIR) && data.ftw.base > 0)
     {
@@ -586,7 +660,7 @@ ftw_startup (const char *dir, int is_nftw, void *func, int descriptors,
 		result = add_object (&data, &st);
 
 	      if (result == 0)
-		result = ftw_dir (&data, &st);
+		result = ftw_dir (&data, &st, NULL);
 	    }
 	  else
 	    {
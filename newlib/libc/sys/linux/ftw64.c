@@ -24,6 +24,7 @@
 #define STAT stat64
 #define LXSTAT lstat64
 #define XSTAT stat64
+#define FSTATAT __libc_fstatat64
 #define FTW_FUNC_T __ftw64_func_t
 #define NFTW_FUNC_T __nftw64_func_t
 
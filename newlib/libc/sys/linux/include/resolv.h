@@ -176,6 +176,7 @@ struct __res_state_ext {
  *   */
 #define RES_F_VC        0x00000001      /* socket is TCP */
 #define RES_F_CONN      0x00000002      /* socket is connected */
+#define RES_F_CACHE     0x00000004      /* getaddrinfo: answers may be cached */
 
 /* res_findzonecut() options */
 #define RES_EXHAUSTIVE  0x00000001      /* always do all queries */
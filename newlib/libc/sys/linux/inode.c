@@ -16,15 +16,19 @@
 
 
 #define __NR___umask __NR_umask
+#define __NR___chdir __NR_chdir
+#define __NR___fchdir __NR_fchdir
+#define __NR___rmdir __NR_rmdir
+#define __NR___chroot __NR_chroot
+#define __NR___symlink __NR_symlink
+
+/* only there if realpath is linked in */
+extern void __realpath_cache_flush (int cwd_only) __attribute__ ((weak));
 
 _syscall2(int,link,const char *,oldpath,const char *,newpath)
 _syscall1(int,unlink,const char *,pathname)
-_syscall1(int,chdir,const char *,path)
-_syscall1(int,fchdir,int,fd)
 _syscall2(int,access,const char *,filename,int,mode)
 _syscall2(int,mkdir,const char *,pathname,mode_t,mode)
-_syscall1(int,rmdir,const char *,pathname)
-_syscall1(int,chroot,const char *,path)
 _syscall2(int,stat,const char *,file_name,struct stat *,buf)
 _syscall2(int,statfs,const char *,file_name,struct statfs *,buf)
 _syscall2(int,fstat,int,filedes,struct stat *,buf)
@@ -38,7 +42,6 @@ _syscall2(int,fchmod,int,filedes,mode_t,mode)
 _syscall3(int,lchown,const char *,path,uid_t,owner,gid_t,group)
 _syscall2(int,lstat,const char *,file_name,struct stat *,buf)
 _syscall3(int,readlink,const char *,path,char *,buf,size_t,bufsiz)
-_syscall2(int,symlink,const char *,oldpath,const char *,newpath)
 _syscall2(int,utime,const char *,filename,const struct utimbuf *,buf)
 #endif
 
@@ -55,6 +58,56 @@ weak_alias(__libc_fstatfs,__fstatfs)
 
 static _syscall3(int,fchown32,int,fd,uid_t,owner,gid_t,group)
 
+/* These may change what names refer to, so the realpath cache must go.  */
+static _syscall1_base(int,__chdir,const char *,path)
+static _syscall1_base(int,__fchdir,int,fd)
+static _syscall1_base(int,__rmdir,const char *,pathname)
+static _syscall1_base(int,__chroot,const char *,path)
+
+int
+__libc_chdir (const char *path)
+{
+  int ret = __libc___chdir (path);
+
+  if (ret == 0 && __realpath_cache_flush)
+    __realpath_cache_flush (1);
+  return ret;
+}
+weak_alias(__libc_chdir,chdir)
+
+int
+__libc_fchdir (int fd)
+{
+  int ret = __libc___fchdir (fd);
+
+  if (ret == 0 && __realpath_cache_flush)
+    __realpath_cache_flush (1);
+  return ret;
+}
+weak_alias(__libc_fchdir,fchdir)
+
+int
+__libc_rmdir (const char *pathname)
+{
+  int ret = __libc___rmdir (pathname);
+
+  if (ret == 0 && __realpath_cache_flush)
+    __realpath_cache_flush (0);
+  return ret;
+}
+weak_alias(__libc_rmdir,rmdir)
+
+int
+__libc_chroot (const char *path)
+{
+  int ret = __libc___chroot (path);
+
+  if (ret == 0 && __realpath_cache_flush)
+    __realpath_cache_flush (0);
+  return ret;
+}
+weak_alias(__libc_chroot,chroot)
+
 int
 fchown (int fd, uid_t owner, gid_t group)
 {
@@ -63,6 +116,19 @@ fchown (int fd, uid_t owner, gid_t group)
 
 #if !defined(_ELIX_LEVEL) || _ELIX_LEVEL >= 2
 
+static _syscall2_base(int,__symlink,const char *,oldpath,const char *,newpath)
+
+int
+__libc_symlink (const char *oldpath, const char *newpath)
+{
+  int ret = __libc___symlink (oldpath, newpath);
+
+  if (ret == 0 && __realpath_cache_flush)
+    __realpath_cache_flush (0);
+  return ret;
+}
+weak_alias(__libc_symlink,symlink)
+
 __LOCK_INIT(static, umask_lock);
 
 _syscall1(mode_t,__umask,mode_t,mask)
@@ -33,6 +33,11 @@ _syscall1(int,fdatasync,int,fd)
 _syscall1(int,fsync,int,fd)
 _syscall3(int,poll,struct pollfd *,fds,nfds_t,nfds,int,timeout)
 
+#ifdef __NR_openat
+/* for use inside the library, see ftw.c */
+_syscall4_base(int,openat,int,dirfd,const char *,file,int,flag,mode_t,mode)
+#endif
+
 #if !defined(_ELIX_LEVEL) || _ELIX_LEVEL >= 2
 _syscall3(ssize_t,readv,int,fd,const struct iovec *,vec,int,count)
 _syscall3(ssize_t,writev,int,fd,const struct iovec *,buf,int,count)
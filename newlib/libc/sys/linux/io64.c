@@ -21,6 +21,11 @@ _syscall2(int,fstat64,int,fd,struct stat64 *,st)
 _syscall2(int,lstat64,const char *,name,struct stat64 *,st)
 _syscall2(int,stat64,const char *,name,struct stat64 *,st)
 
+#ifdef __NR_fstatat64
+/* for use inside the library, see ftw.c */
+_syscall4_base(int,fstatat64,int,dirfd,const char *,name,struct stat64 *,st,int,flags)
+#endif
+
 static _syscall3(int,__truncate64,const char *,name,int,high,int,low)
 
 int __libc_truncate64(const char *name, off64_t length)
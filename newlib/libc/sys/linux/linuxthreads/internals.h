@@ -186,6 +186,8 @@ struct _pthread_descr_struct {
 #if HP_TIMING_AVAIL
   hp_timing_t p_cpuclock_offset; /* Initial CPU clock for thread.  */
 #endif
+  void * p_specific_first[PTHREAD_KEY_2NDLEVEL_SIZE];
+				/* p_specific[0], never freed */
   /* New elements must be added at the end.  */
 } __attribute__ ((__aligned__(32))); /* We need to align the structure so that
 				    doubles are aligned properly.  This is 8
@@ -376,12 +378,10 @@ static inline int nonexisting_handle(pthread_handle h, pthread_t id)
 
 extern pthread_descr __pthread_find_self (void) __attribute__ ((__const__));
 
-static inline pthread_descr thread_self (void) __attribute__ ((__const__));
-static inline pthread_descr thread_self (void)
+#ifndef THREAD_SELF
+static inline pthread_descr thread_self_stack (void) __attribute__ ((__const__));
+static inline pthread_descr thread_self_stack (void)
 {
-#ifdef THREAD_SELF
-  return THREAD_SELF;
-#else
   char *sp = CURRENT_STACK_FRAME;
   if (sp >= __pthread_initial_thread_bos)
     return &__pthread_initial_thread;
@@ -396,6 +396,23 @@ static inline pthread_descr thread_self (void)
 #else
     return (pthread_descr)((unsigned long)sp &~ (STACK_SIZE-1));
 #endif
+}
+#endif
+
+static inline pthread_descr thread_self (void) __attribute__ ((__const__));
+static inline pthread_descr thread_self (void)
+{
+#ifdef THREAD_SELF
+  return THREAD_SELF;
+#else
+# ifdef THREAD_REGISTER_SELF
+  /* Between clone() and INIT_THREAD_SELF a new thread still sees the
+     manager's register; see pthread_handle_sigcancel.  */
+  pthread_descr self = THREAD_REGISTER_SELF;
+  if (self != NULL)
+    return self;
+# endif
+  return thread_self_stack();
 #endif
 }
 
@@ -508,6 +525,10 @@ extern void __pthread_restart_new(pthread_descr th);
 extern void __pthread_suspend_new(pthread_descr self);
 extern int __pthread_timedsuspend_new(pthread_descr self, const struct timespec *abs);
 
+extern void __pthread_restart_futex(pthread_descr th);
+extern void __pthread_suspend_futex(pthread_descr self);
+extern int __pthread_timedsuspend_futex(pthread_descr self, const struct timespec *abs);
+
 extern void __pthread_wait_for_restart_signal(pthread_descr self);
 
 extern int __pthread_yield (void);
@@ -534,7 +555,7 @@ extern int __pthread_clock_gettime (hp_timing_t freq, struct timespec *tp);
 extern void __pthread_clock_settime (hp_timing_t offset);
 
 
-/* Global pointers to old or new suspend functions */
+/* Global pointers to futex, old or new suspend functions */
 
 extern void (*__pthread_restart)(pthread_descr);
 extern void (*__pthread_suspend)(pthread_descr);
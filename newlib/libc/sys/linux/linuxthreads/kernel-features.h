@@ -49,6 +49,12 @@
 # define __ASSUME_REALTIME_SIGNALS	1
 #endif
 
+/* The futex system call is there since 2.5.40, but we only rely on it
+   from 2.6.0 on.  */
+#if __LINUX_KERNEL_VERSION >= 132608
+# define __ASSUME_FUTEX			1
+#endif
+
 /* When were the `pread'/`pwrite' syscalls introduced?  */
 #if __LINUX_KERNEL_VERSION >= 131584
 # define __ASSUME_PREAD_SYSCALL		1
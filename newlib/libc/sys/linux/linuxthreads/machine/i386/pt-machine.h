@@ -19,6 +19,8 @@
    write to the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
    Boston, MA 02111-1307, USA.  */
 
+#include <stddef.h>	/* For offsetof.  */
+
 #ifndef PT_EI
 # define PT_EI extern inline
 #endif
@@ -96,3 +98,28 @@ compare_and_swap_is_available (void)
      Otherwise, it's a 486 or above and it has cmpxchg.  */
   return changed != 0;
 }
+
+
+/* Thread register.  Each thread loads %gs with a selector for a
+   segment based at its own descriptor (see __pthread_init_thread_register
+   in pthread.c), so finding the descriptor is a single load instead of a
+   search on the stack pointer.  %gs is 0 until that is done, or if the
+   kernel has no set_thread_area; thread_self() then falls back to the
+   stack pointer.  */
+#define THREAD_REGISTER_SELF \
+({									      \
+  register struct _pthread_descr_struct *__self = NULL;			      \
+  unsigned short int __sel;						      \
+  __asm__ ("movw %%gs,%w0" : "=r" (__sel));				      \
+  if (__sel != 0)							      \
+    __asm__ ("movl %%gs:%c1,%0" : "=r" (__self)				      \
+	     : "i" (offsetof (struct _pthread_descr_struct,		      \
+			      p_header.data.self)));			      \
+  __self;								      \
+})
+
+struct _pthread_descr_struct;
+extern void __pthread_init_thread_register (struct _pthread_descr_struct *);
+
+/* Initialize the thread-unique value.  */
+#define INIT_THREAD_SELF(descr, nr) __pthread_init_thread_register (descr)
@@ -75,6 +75,75 @@ static inline pthread_descr thread_segment(int seg)
 }
 #endif
 
+/* Stacks of freed threads are kept here for reuse instead of being
+   unmapped, which saves the mmap, mprotect and munmap calls when threads
+   come and go.  A stack is only reused for a thread with the same stack
+   and guard sizes.  Without floating stacks, each stack segment has its
+   own fixed address, so a kept stack is only reused by the next thread
+   in its segment, and is unmapped if that thread needs other sizes.
+   Only the thread manager uses the cache. */
+
+#define STACK_CACHE_ENTRIES	16
+#define STACK_CACHE_BYTES	(40 * 1024 * 1024)
+
+static struct {
+  char * map_addr;
+  size_t stacksize, guardsize;
+} stack_cache[STACK_CACHE_ENTRIES];
+static int stack_cache_count;
+static size_t stack_cache_bytes;
+
+static char * stack_cache_get(char * want_addr, size_t stacksize,
+			      size_t guardsize)
+{
+  char * map_addr;
+  size_t size;
+  int i;
+
+  for (i = stack_cache_count - 1; i >= 0; i--)
+    {
+      map_addr = stack_cache[i].map_addr;
+      size = stack_cache[i].stacksize + stack_cache[i].guardsize;
+#if !FLOATING_STACKS
+      if (map_addr >= want_addr + stacksize + guardsize
+	  || map_addr + size <= want_addr)
+	continue;		/* another segment */
+      if (map_addr != want_addr
+	  || stack_cache[i].stacksize != stacksize
+	  || stack_cache[i].guardsize != guardsize)
+	{
+	  /* In the way of the new stack.  */
+	  munmap(map_addr, size);
+	  stack_cache[i] = stack_cache[--stack_cache_count];
+	  stack_cache_bytes -= size;
+	  continue;
+	}
+#else
+      if (stack_cache[i].stacksize != stacksize
+	  || stack_cache[i].guardsize != guardsize)
+	continue;
+#endif
+      stack_cache[i] = stack_cache[--stack_cache_count];
+      stack_cache_bytes -= size;
+      return map_addr;
+    }
+  return NULL;
+}
+
+static int stack_cache_put(char * map_addr, size_t stacksize,
+			   size_t guardsize)
+{
+  if (stack_cache_count == STACK_CACHE_ENTRIES
+      || stack_cache_bytes + stacksize + guardsize > STACK_CACHE_BYTES)
+    return 0;
+  stack_cache[stack_cache_count].map_addr = map_addr;
+  stack_cache[stack_cache_count].stacksize = stacksize;
+  stack_cache[stack_cache_count].guardsize = guardsize;
+  stack_cache_count++;
+  stack_cache_bytes += stacksize + guardsize;
+  return 1;
+}
+
 /* Flag set in signal handler to record child termination */
 
 static volatile int terminated_children;
@@ -286,7 +355,9 @@ pthread_start_thread(void *arg)
     request.req_kind = REQ_DEBUG;
     TEMP_FAILURE_RETRY(__libc_write(__pthread_manager_request,
 				    (char *) &request, sizeof(request)));
-    suspend(self);
+    /* gdb sends the restart signal itself, so wait for the signal even
+       when restart() does not use it. */
+    __pthread_wait_for_restart_signal(self);
   }
   /* Run the thread code */
   outcome = self->p_start_args.start_routine(THREAD_GETMEM(self,
@@ -372,6 +443,8 @@ static int pthread_allocate_stack(const pthread_attr_t *attr,
 
       /* Allocate space for stack and thread descriptor at default address */
 #if FLOATING_STACKS
+      int reused;
+
       if (attr != NULL)
 	{
 	  guardsize = page_roundup (attr->__guardsize, granularity);
@@ -385,16 +458,22 @@ static int pthread_allocate_stack(const pthread_attr_t *attr,
 	  stacksize = __pthread_max_stacksize - guardsize;
 	}
 
-      map_addr = mmap(NULL, stacksize + guardsize,
-		      PROT_READ | PROT_WRITE | PROT_EXEC,
-		      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
-      if (map_addr == MAP_FAILED)
-        /* No more memory available.  */
-        return -1;
+      map_addr = stack_cache_get(NULL, stacksize, guardsize);
+      reused = map_addr != NULL;
+      if (!reused)
+	{
+	  map_addr = mmap(NULL, stacksize + guardsize,
+			  PROT_READ | PROT_WRITE | PROT_EXEC,
+			  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	  if (map_addr == MAP_FAILED)
+	    /* No more memory available.  */
+	    return -1;
+	}
 
+      /* A cached stack still has its guard area protected. */
 # ifdef NEED_SEPARATE_REGISTER_STACK
       guardaddr = map_addr + stacksize / 2;
-      if (guardsize > 0)
+      if (guardsize > 0 && !reused)
 	mprotect (guardaddr, guardsize, PROT_NONE);
 
       new_thread_bottom = (char *) map_addr;
@@ -402,14 +481,14 @@ static int pthread_allocate_stack(const pthread_attr_t *attr,
 				     + guardsize)) - 1;
 # elif _STACK_GROWS_DOWN
       guardaddr = map_addr;
-      if (guardsize > 0)
+      if (guardsize > 0 && !reused)
 	mprotect (guardaddr, guardsize, PROT_NONE);
 
       new_thread_bottom = (char *) map_addr + guardsize;
       new_thread = ((pthread_descr) (new_thread_bottom + stacksize)) - 1;
 # elif _STACK_GROWS_UP
       guardaddr = map_addr + stacksize;
-      if (guardsize > 0)
+      if (guardsize > 0 && !reused)
 	mprotect (guardaddr, guardsize, PROT_NONE);
 
       new_thread = (pthread_descr) map_addr;
@@ -417,8 +496,13 @@ static int pthread_allocate_stack(const pthread_attr_t *attr,
 # else
 #  error You must define a stack direction
 # endif /* Stack direction */
+
+      /* Unlike fresh pages, the old descriptor must be cleared.  */
+      if (reused)
+	memset (new_thread, '\0', sizeof (*new_thread));
 #else /* !FLOATING_STACKS */
       void *res_addr;
+      int reused;
 
       if (attr != NULL)
 	{
@@ -433,6 +517,16 @@ static int pthread_allocate_stack(const pthread_attr_t *attr,
 	  stacksize = STACK_SIZE - granularity;
 	}
 
+      /* The stack of this segment may still be mapped from the last
+	 thread that used it.  */
+# if defined NEED_SEPARATE_REGISTER_STACK || defined _STACK_GROWS_DOWN
+      map_addr = (char *)(default_new_thread + 1) - stacksize - guardsize;
+# else
+      map_addr = (caddr_t)((unsigned long)default_new_thread
+			   &~ (STACK_SIZE - 1));
+# endif
+      reused = stack_cache_get(map_addr, stacksize, guardsize) != NULL;
+
 # ifdef NEED_SEPARATE_REGISTER_STACK
       new_thread = default_new_thread;
       new_thread_bottom = (char *) (new_thread + 1) - stacksize - guardsize;
@@ -444,30 +538,33 @@ static int pthread_allocate_stack(const pthread_attr_t *attr,
        in the same region.  The cost is that we might be able to map
        slightly fewer stacks.  */
 
-      /* First the main stack: */
-      map_addr = (caddr_t)((char *)(new_thread + 1) - stacksize / 2);
-      res_addr = mmap(map_addr, stacksize / 2,
-		      PROT_READ | PROT_WRITE | PROT_EXEC,
-		      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
-      if (res_addr != map_addr)
-	{
-	  /* Bad luck, this segment is already mapped. */
-	  if (res_addr != MAP_FAILED)
-	    munmap(res_addr, stacksize / 2);
-	  return -1;
-	}
-      /* Then the register stack:	*/
-      map_addr = (caddr_t)new_thread_bottom;
-      res_addr = mmap(map_addr, stacksize/2,
-		      PROT_READ | PROT_WRITE | PROT_EXEC,
-		      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
-      if (res_addr != map_addr)
+      if (!reused)
 	{
-	  if (res_addr != MAP_FAILED)
-	    munmap(res_addr, stacksize / 2);
-	  munmap((caddr_t)((char *)(new_thread + 1) - stacksize/2),
-		 stacksize/2);
-	  return -1;
+	  /* First the main stack: */
+	  map_addr = (caddr_t)((char *)(new_thread + 1) - stacksize / 2);
+	  res_addr = mmap(map_addr, stacksize / 2,
+			  PROT_READ | PROT_WRITE | PROT_EXEC,
+			  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	  if (res_addr != map_addr)
+	    {
+	      /* Bad luck, this segment is already mapped. */
+	      if (res_addr != MAP_FAILED)
+		munmap(res_addr, stacksize / 2);
+	      return -1;
+	    }
+	  /* Then the register stack:	*/
+	  map_addr = (caddr_t)new_thread_bottom;
+	  res_addr = mmap(map_addr, stacksize/2,
+			  PROT_READ | PROT_WRITE | PROT_EXEC,
+			  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	  if (res_addr != map_addr)
+	    {
+	      if (res_addr != MAP_FAILED)
+		munmap(res_addr, stacksize / 2);
+	      munmap((caddr_t)((char *)(new_thread + 1) - stacksize/2),
+		     stacksize/2);
+	      return -1;
+	    }
 	}
 
       guardaddr = new_thread_bottom + stacksize/2;
@@ -476,41 +573,51 @@ static int pthread_allocate_stack(const pthread_attr_t *attr,
 #  ifdef _STACK_GROWS_DOWN
       new_thread = default_new_thread;
       new_thread_bottom = (char *) (new_thread + 1) - stacksize;
-      map_addr = new_thread_bottom - guardsize;
-      res_addr = mmap(map_addr, stacksize + guardsize,
-		      PROT_READ | PROT_WRITE | PROT_EXEC,
-		      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
-      if (res_addr != map_addr)
+      if (!reused)
 	{
-	  /* Bad luck, this segment is already mapped. */
-	  if (res_addr != MAP_FAILED)
-	    munmap (res_addr, stacksize + guardsize);
-	  return -1;
-	}
+	  res_addr = mmap(map_addr, stacksize + guardsize,
+			  PROT_READ | PROT_WRITE | PROT_EXEC,
+			  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	  if (res_addr != map_addr)
+	    {
+	      /* Bad luck, this segment is already mapped. */
+	      if (res_addr != MAP_FAILED)
+		munmap (res_addr, stacksize + guardsize);
+	      return -1;
+	    }
 
-      /* We manage to get a stack.  Protect the guard area pages if
-	 necessary.  */
+	  /* We manage to get a stack.  Protect the guard area pages if
+	     necessary.  */
+	  if (guardsize > 0)
+	    mprotect (map_addr, guardsize, PROT_NONE);
+	}
       guardaddr = map_addr;
-      if (guardsize > 0)
-	mprotect (guardaddr, guardsize, PROT_NONE);
 #  else
       /* The thread description goes at the bottom of this area, and
        * the stack starts directly above it.
        */
-      new_thread = (pthread_descr)((unsigned long)default_new_thread &~ (STACK_SIZE - 1));
-      map_addr = mmap(new_thread, stacksize + guardsize,
-		      PROT_READ | PROT_WRITE | PROT_EXEC,
-		      MAP_FIXED | MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
-      if (map_addr == MAP_FAILED)
-	  return -1;
+      new_thread = (pthread_descr) map_addr;
+      if (!reused)
+	{
+	  res_addr = mmap(map_addr, stacksize + guardsize,
+			  PROT_READ | PROT_WRITE | PROT_EXEC,
+			  MAP_FIXED | MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	  if (res_addr == MAP_FAILED)
+	    return -1;
+	  if (guardsize > 0)
+	    mprotect (map_addr + stacksize, guardsize, PROT_NONE);
+	}
 
       new_thread_bottom = map_addr + sizeof(*new_thread);
       guardaddr = map_addr + stacksize;
-      if (guardsize > 0)
-	  mprotect (guardaddr, guardsize, PROT_NONE);
 
 #  endif /* stack direction */
 # endif  /* !NEED_SEPARATE_REGISTER_STACK */
+
+      /* A kept stack still has its guard area protected, but the old
+	 descriptor must be cleared.  */
+      if (reused)
+	memset (new_thread, '\0', sizeof (*new_thread));
 #endif   /* !FLOATING_STACKS */
     }
   *out_new_thread = new_thread;
@@ -568,6 +675,7 @@ static int pthread_handle_create(pthread_t *thread, const pthread_attr_t *attr,
   _REENT_INIT_PTR(new_thread->p_reentp);
   new_thread->p_h_errnop = &new_thread->p_h_errno;
   new_thread->p_resp = &new_thread->p_res;
+  new_thread->p_specific[0] = new_thread->p_specific_first;
   new_thread->p_guardaddr = guardaddr;
   new_thread->p_guardsize = guardsize;
   new_thread->p_header.data.self = new_thread;
@@ -779,6 +887,9 @@ static void pthread_free(pthread_descr th)
       stacksize *= 2;
 #endif
 #endif
+      /* Keep the stack for another thread if there is room.  */
+      if (stack_cache_put(guardaddr, stacksize, guardsize))
+	return;
       /* Unmap the stack.  */
       munmap(guardaddr, stacksize + guardsize);
     }
@@ -3,8 +3,8 @@
 #include <mqueue.h>
 #include <unistd.h>
 #include <errno.h>
-#include <sys/ipc.h>
-#include <sys/sem.h>
+#include <limits.h>
+#include <signal.h>
 #include <string.h>
 
 #include "internals.h"
@@ -14,57 +14,65 @@
 
 static void *mq_notify_process (void *);
 
+/* Withdraw the registration made through INFO, if it has not fired
+   yet, and get rid of its thread.  */
 void
 __cleanup_mq_notify (struct libc_mq *info)
 {
-  struct sembuf sb4 = {4, 1, 0};
-  /* kill notification thread and allow other processes to set a notification */
-  pthread_cancel ((pthread_t)info->th);
-  semop (info->semid, &sb4, 1);
+  struct mq_hdr *hdr = info->hdr;
+  pthread_t th = (pthread_t)info->th;
+
+  __mq_lock (hdr);
+  if (hdr->notify_pid != 0 && hdr->notifyseq == info->notifyseq)
+    hdr->notify_pid = 0;
+  info->notify_stop = 1;
+  __mq_unlock (hdr);
+  __mq_wake (&hdr->notifyseq, INT_MAX);
+
+  /* a notification function may close or rearm the queue itself */
+  if (pthread_equal (th, pthread_self ()))
+    pthread_detach (th);
+  else
+    pthread_join (th, NULL);
+  info->cleanup_notify = NULL;
 }
-  
+
 static void *
 mq_notify_process (void *arg)
 {
   struct libc_mq *info = (struct libc_mq *)arg;
-  struct sembuf sb3[2] = {{3, 0, 0}, {5, 0, 0}};
-  struct sembuf sb4 = {4, 1, 0};
-  int rc;
-
-  /* wait until queue is empty */
-  while (!(rc = semop (info->semid, sb3, 1)) && errno == EINTR)
-    /* empty */ ;
-
-  if (!rc)
+  struct mq_hdr *hdr = info->hdr;
+  int nwait = 0;
+  int fire;
+
+  /* wait until mq_send finds the queue empty, no receiver waiting and
+     our registration in place; it then removes the registration and
+     moves notifyseq on */
+  __mq_lock (hdr);
+  while (hdr->notifyseq == info->notifyseq && !info->notify_stop)
+    __mq_wait (hdr, &hdr->notifyseq, &nwait);
+  fire = !info->notify_stop;
+  __mq_unlock (hdr);
+
+  /* perform desired notification - either run function in this thread or pass signal */
+  if (fire)
     {
-      /* now wait until there are 0 readers and the queue has something in it */
-      sb3[0].sem_op = -1;
-      while (!(rc = semop (info->semid, sb3, 2)) && errno == EINTR)
-	/* empty */ ;
-      /* restore value since we have not actually performed a read */
-      sb3[0].sem_op = 1;
-      semop (info->semid, sb3, 1);
-      /* perform desired notification - either run function in this thread or pass signal */
-      if (!rc)
-	{
-	  if (info->sigevent->sigev_notify == SIGEV_SIGNAL)
-	    raise (info->sigevent->sigev_signo);
-	  else if (info->sigevent->sigev_notify == SIGEV_THREAD)
-	    info->sigevent->sigev_notify_function (info->sigevent->sigev_value);
-	  /* allow other processes to now mq_notify */
-	  semop (info->semid, &sb4, 1);
-	}
+      if (info->sigevent.sigev_notify == SIGEV_SIGNAL)
+	raise (info->sigevent.sigev_signo);
+      else if (info->sigevent.sigev_notify == SIGEV_THREAD)
+	info->sigevent.sigev_notify_function (info->sigevent.sigev_value);
     }
-  pthread_exit (NULL);
+  return NULL;
 }
 
 int
 mq_notify (mqd_t msgid, const struct sigevent *notification)
 {
   struct libc_mq *info;
-  struct sembuf sb4 = {4, -1, IPC_NOWAIT};
-  int rc;
+  struct mq_hdr *hdr;
   pthread_attr_t *attr = NULL;
+  pid_t pid;
+  int rc;
 
   info = __find_mq (msgid);
 
@@ -74,33 +82,58 @@ mq_notify (mqd_t msgid, const struct sigevent *notification)
       return -1;
     }
 
-  /* get notification lock */
-  rc = semop (info->semid, &sb4, 1);
+  hdr = info->hdr;
 
-  if (rc == -1)
+  /* a registration through this descriptor which is still pending
+     blocks a new one; one that has fired leaves a thread to reap */
+  if (info->cleanup_notify != NULL)
     {
+      __mq_lock (hdr);
+      rc = (hdr->notify_pid != 0 && hdr->notifyseq == info->notifyseq);
+      __mq_unlock (hdr);
+      if (rc && notification != NULL)
+	{
+	  errno = EBUSY;
+	  return -1;
+	}
+      info->cleanup_notify (info);
+    }
+
+  if (notification == NULL)
+    return 0;
+
+  /* get notification lock - a registration left behind by a process
+     that has gone away does not count */
+  __mq_lock (hdr);
+  pid = hdr->notify_pid;
+  if (pid != 0 && (kill (pid, 0) == 0 || errno != ESRCH))
+    {
+      __mq_unlock (hdr);
       errno = EBUSY;
       return -1;
     }
+  hdr->notify_pid = getpid ();
+  info->notifyseq = hdr->notifyseq;
+  info->notify_stop = 0;
+  __mq_unlock (hdr);
 
   /* to get the notification running we use a pthread - if the user has requested
      an action in a pthread, we use the user's attributes when setting up the thread */
-  info->sigevent = (struct sigevent *)notification;
-  if (info->sigevent->sigev_notify == SIGEV_THREAD)
-    attr = (pthread_attr_t *)info->sigevent->sigev_notify_attributes;
+  info->sigevent = *notification;
+  if (info->sigevent.sigev_notify == SIGEV_THREAD)
+    attr = (pthread_attr_t *)info->sigevent.sigev_notify_attributes;
   rc = pthread_create ((pthread_t *)&info->th, attr, mq_notify_process, (void *)info);
 
   if (rc != 0)
-    rc = -1;
-  else
-    info->cleanup_notify = &__cleanup_mq_notify;
+    {
+      __mq_lock (hdr);
+      if (hdr->notifyseq == info->notifyseq)
+	hdr->notify_pid = 0;
+      __mq_unlock (hdr);
+      errno = rc;
+      return -1;
+    }
 
-  return rc;
+  info->cleanup_notify = &__cleanup_mq_notify;
+  return 0;
 }
-
-      
-
-
-
-
-
@@ -34,6 +34,31 @@ struct list_links
 struct timer_node;
 
 
+/* Timers queued on a thread are kept in a hierarchical timing wheel.
+   The clock is cut into ticks of 2^TIMER_TICK_SHIFT nanoseconds (about
+   a millisecond).  Level 0 has one slot per tick, each further level
+   has slots TIMER_WHEEL_SIZE times as long.  A timer sits in the lowest
+   level whose period it shares with the wheel's current tick and is
+   moved down when that tick reaches its slot, so arming and cancelling
+   a timer are constant time.  Timers beyond the last level wait on the
+   overflow list.  */
+#define TIMER_TICK_SHIFT	20
+#define TIMER_WHEEL_BITS	6
+#define TIMER_WHEEL_SIZE	(1 << TIMER_WHEEL_BITS)
+#define TIMER_WHEEL_LEVELS	4
+#define TIMER_WHEEL_OVERFLOW	(TIMER_WHEEL_LEVELS * TIMER_WHEEL_SIZE)
+
+struct timer_wheel
+{
+  unsigned long long int now;
+  unsigned int count;
+  unsigned long long int occupied[TIMER_WHEEL_LEVELS];
+  struct list_links slot[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SIZE];
+  struct list_links overflow;
+  unsigned long long int overflow_min;
+};
+
+
 /* Definitions for an internal thread of the POSIX timer implementation.  */
 struct thread_node
 {
@@ -41,7 +66,9 @@ struct thread_node
   pthread_attr_t attr;
   pthread_t id;
   unsigned int exists;
-  struct list_links timer_queue;
+  struct timer_wheel timer_queue;
+  struct timespec wakeup;
+  unsigned int have_wakeup;
   pthread_cond_t cond;
   struct timer_node *current_timer;
   pthread_t captured;
@@ -60,6 +87,7 @@ struct timer_node
   pthread_attr_t attr;
   unsigned int abstime;
   unsigned int armed;
+  int wheel_slot;
   enum {
     TIMER_FREE, TIMER_INUSE, TIMER_DELETED
   } inuse;
@@ -207,4 +235,5 @@ extern struct thread_node *__timer_thread_alloc (const pthread_attr_t *desired_a
 extern void __timer_thread_dealloc (struct thread_node *thread);
 extern int __timer_thread_queue_timer (struct thread_node *thread,
 				       struct timer_node *insert);
+extern void __timer_thread_dequeue_timer (struct timer_node *timer);
 extern void __timer_thread_wakeup (struct thread_node *thread);
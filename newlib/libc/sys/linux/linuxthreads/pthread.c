@@ -31,6 +31,7 @@
 #include "spinlock.h"
 #include "restart.h"
 #include <machine/syscall.h>
+#include <sysdep.h>
 
 /* for threading we use processes so we require a few EL/IX level 2 and 
    level 3 syscalls.  We only allow this file to see them to preserve
@@ -72,6 +73,81 @@ int on_exit (void (*fn)(int, void *), void *arg)
 
 #endif /* _ELIX_LEVEL < 2 */
 
+#ifdef __NR_futex
+/* Futex operations, see <linux/futex.h>. */
+#define FUTEX_WAIT	0
+#define FUTEX_WAKE	1
+
+static int __futex(long *addr, int op, long val,
+		   const struct timespec *timeout)
+{
+  /* Leave errno alone, the callers are not system calls. */
+  int saved_errno = errno;
+  int err = 0;
+
+  if (INLINE_SYSCALL(futex, 4, addr, op, val, timeout) == -1) {
+    err = errno;
+    __set_errno(saved_errno);
+  }
+  return err;
+}
+
+#endif /* __NR_futex */
+
+#ifdef THREAD_REGISTER_SELF
+/* Descriptor passed to set_thread_area, see <asm/ldt.h>. */
+struct thread_area_desc {
+  unsigned int entry_number;
+  unsigned long int base_addr;
+  unsigned int limit;
+  unsigned int seg_32bit:1;
+  unsigned int contents:2;
+  unsigned int read_exec_only:1;
+  unsigned int limit_in_pages:1;
+  unsigned int seg_not_present:1;
+  unsigned int useable:1;
+  unsigned int empty:25;
+};
+
+/* GDT entry used for the thread register: -1 until the kernel picked one
+   for the initial thread, -2 if it cannot give us one.  The TLS entries
+   are per thread, so every thread reuses the same slot for its own
+   descriptor and nothing has to be freed when a thread exits.  */
+static int thread_area_entry = -1;
+
+void __pthread_init_thread_register(pthread_descr self)
+{
+#ifdef __NR_set_thread_area
+  struct thread_area_desc desc;
+  int saved_errno;
+
+  if (thread_area_entry == -2)
+    return;
+  desc.entry_number = thread_area_entry;
+  desc.base_addr = (unsigned long int) self;
+  desc.limit = sizeof(*self) - 1;
+  desc.seg_32bit = 1;
+  desc.contents = 0;
+  desc.read_exec_only = 0;
+  desc.limit_in_pages = 0;
+  desc.seg_not_present = 0;
+  desc.useable = 1;
+  desc.empty = 0;
+  saved_errno = errno;
+  if (INLINE_SYSCALL(set_thread_area, 1, &desc) == -1) {
+    /* Only the initial thread gets here, before any other thread runs;
+       everybody stays on the stack pointer method.  */
+    __set_errno(saved_errno);
+    thread_area_entry = -2;
+    return;
+  }
+  thread_area_entry = desc.entry_number;
+  __asm__ __volatile__ ("movw %w0, %%gs"
+			: : "q" (desc.entry_number * 8 + 3));
+#endif
+}
+#endif /* THREAD_REGISTER_SELF */
+
 /* We need the global/static resolver state here.  */
 #include <resolv.h>
 #undef _res
@@ -123,7 +199,8 @@ struct _pthread_descr_struct __pthread_initial_thread = {
   0,                          /* char p_sigwaiting */
   PTHREAD_START_ARGS_INITIALIZER(NULL),
                               /* struct pthread_start_args p_start_args */
-  {NULL},                     /* void ** p_specific[PTHREAD_KEY_1STLEVEL_SIZE] */
+  {__pthread_initial_thread.p_specific_first},
+                              /* void ** p_specific[PTHREAD_KEY_1STLEVEL_SIZE] */
   {NULL},                     /* void * p_libc_specific[_LIBC_TSD_KEY_N] */
   1,                          /* int p_userstack */
   NULL,                       /* void * p_guardaddr */
@@ -180,7 +257,8 @@ struct _pthread_descr_struct __pthread_manager_thread = {
   0,                          /* char p_sigwaiting */
   PTHREAD_START_ARGS_INITIALIZER(__pthread_manager),
                               /* struct pthread_start_args p_start_args */
-  {NULL},                     /* void ** p_specific[PTHREAD_KEY_1STLEVEL_SIZE] */
+  {__pthread_manager_thread.p_specific_first},
+                              /* void ** p_specific[PTHREAD_KEY_1STLEVEL_SIZE] */
   {NULL},                     /* void * p_libc_specific[_LIBC_TSD_KEY_N] */
   0,                          /* int p_userstack */
   NULL,                       /* void * p_guardaddr */
@@ -234,14 +312,20 @@ size_t __pthread_max_stacksize;
 int __pthread_smp_kernel;
 
 
-#if !__ASSUME_REALTIME_SIGNALS
-/* Pointers that select new or old suspend/resume functions
-   based on availability of rt signals. */
+#if !__ASSUME_FUTEX
+/* Pointers that select futex, new or old suspend/resume functions
+   based on availability of futexes and rt signals. */
 
+#if __ASSUME_REALTIME_SIGNALS
+void (*__pthread_restart)(pthread_descr) = __pthread_restart_new;
+void (*__pthread_suspend)(pthread_descr) = __pthread_wait_for_restart_signal;
+int (*__pthread_timedsuspend)(pthread_descr, const struct timespec *) = __pthread_timedsuspend_new;
+#else
 void (*__pthread_restart)(pthread_descr) = __pthread_restart_old;
 void (*__pthread_suspend)(pthread_descr) = __pthread_suspend_old;
 int (*__pthread_timedsuspend)(pthread_descr, const struct timespec *) = __pthread_timedsuspend_old;
 #endif	/* __ASSUME_REALTIME_SIGNALS */
+#endif	/* __ASSUME_FUTEX */
 
 /* Communicate relevant LinuxThreads constants to gdb */
 
@@ -336,6 +420,23 @@ init_rtsigs (void)
 }
 #endif
 
+#if !__ASSUME_FUTEX && defined __NR_futex
+/* Use futexes instead of the restart signal if the kernel has them. */
+
+static void
+init_futex (void)
+{
+  long word = 0;
+
+  if (__futex(&word, FUTEX_WAKE, 1, NULL) != ENOSYS)
+    {
+      __pthread_restart = __pthread_restart_futex;
+      __pthread_suspend = __pthread_suspend_futex;
+      __pthread_timedsuspend = __pthread_timedsuspend_futex;
+    }
+}
+#endif
+
 /* Return number of available real-time signal with highest priority.  */
 int
 __libc_current_sigrtmin (void)
@@ -509,9 +610,18 @@ static void pthread_initialize(void)
   __pthread_initial_thread.p_pid = __getpid();
   /* Likewise for the resolver state _res.  */
   __pthread_initial_thread.p_resp = &_res;
+  /* __pthread_initialize_minimal is not run from the startup code here,
+     so load the thread register of the initial thread now.  */
+#ifdef INIT_THREAD_SELF
+  INIT_THREAD_SELF(&__pthread_initial_thread, 0);
+#endif
 #ifdef __SIGRTMIN
   /* Initialize real-time signals. */
   init_rtsigs ();
+#endif
+#if !__ASSUME_FUTEX && defined __NR_futex
+  /* Prefer futexes for suspend/restart. */
+  init_futex ();
 #endif
   /* Setup signal handlers for the initial thread.
      Since signal handlers are shared between threads, these settings
@@ -891,7 +1001,14 @@ static void pthread_handle_sigrestart(int sig)
 
 static void pthread_handle_sigcancel(int sig)
 {
+#ifdef THREAD_REGISTER_SELF
+  /* A new thread might get a cancel signal before it has loaded its
+     thread register, which then still points to the descriptor of the
+     thread that cloned it.  Go by the stack pointer instead.  */
+  pthread_descr self = thread_self_stack();
+#else
   pthread_descr self = thread_self();
+#endif
   sigjmp_buf * jmpbuf;
 
   if (self == &__pthread_manager_thread)
@@ -1216,6 +1333,66 @@ __pthread_timedsuspend_new(pthread_descr self, const struct timespec *abstime)
   return was_signalled;
 }
 
+#ifdef __NR_futex
+/* The futex variants need no signal at all. Like the _old variants they
+   count restarts in p_resume_count, which is -1 while the thread sleeps
+   in FUTEX_WAIT on it, so restart() only enters the kernel when there is
+   a thread to wake up. Queuing semantics are the same as for the _old
+   variants: a restart that comes before the suspend is not lost. */
+
+void __pthread_restart_futex(pthread_descr th)
+{
+  WRITE_MEMORY_BARRIER(); /* See comment in __pthread_restart_new */
+  if (atomic_increment(&th->p_resume_count) < 0)
+    __futex(&th->p_resume_count.p_count, FUTEX_WAKE, 1, NULL);
+}
+
+void __pthread_suspend_futex(pthread_descr self)
+{
+  if (atomic_decrement(&self->p_resume_count) <= 0) {
+    /* Spurious wakeups and signals just get us round the loop again. */
+    while (self->p_resume_count.p_count < 0)
+      __futex(&self->p_resume_count.p_count, FUTEX_WAIT, -1, NULL);
+  }
+  READ_MEMORY_BARRIER(); /* See comment in __pthread_restart_new */
+}
+
+int
+__pthread_timedsuspend_futex(pthread_descr self, const struct timespec *abstime)
+{
+  if (atomic_decrement(&self->p_resume_count) <= 0) {
+    while (self->p_resume_count.p_count < 0) {
+      struct timeval now;
+      struct timespec reltime;
+
+      /* FUTEX_WAIT wants a time offset relative to now.  */
+      __gettimeofday (&now, NULL);
+      reltime.tv_nsec = abstime->tv_nsec - now.tv_usec * 1000;
+      reltime.tv_sec = abstime->tv_sec - now.tv_sec;
+      if (reltime.tv_nsec < 0) {
+	reltime.tv_nsec += 1000000000;
+	reltime.tv_sec -= 1;
+      }
+
+      if (reltime.tv_sec < 0
+	  || __futex(&self->p_resume_count.p_count, FUTEX_WAIT, -1,
+		     &reltime) == ETIMEDOUT) {
+	/* Timed out. Take back our decrement; if it goes to 0, no restart
+	   was delivered and the caller must resolve the race as for
+	   __pthread_timedsuspend_old. Otherwise a restart came in the
+	   meantime: consume it and report a wakeup. */
+	if (atomic_increment(&self->p_resume_count) < 0)
+	  return 0;
+	atomic_decrement(&self->p_resume_count);
+	break;
+      }
+    }
+  }
+  READ_MEMORY_BARRIER(); /* See comment in __pthread_restart_new */
+  return 1;
+}
+#endif /* __NR_futex */
+
 
 /* Debugging aid */
 
@@ -20,8 +20,8 @@
 static inline void restart(pthread_descr th)
 {
   /* See pthread.c */
-#if __ASSUME_REALTIME_SIGNALS
-  __pthread_restart_new(th);
+#if __ASSUME_FUTEX
+  __pthread_restart_futex(th);
 #else
   __pthread_restart(th);
 #endif
@@ -30,8 +30,8 @@ static inline void restart(pthread_descr th)
 static inline void suspend(pthread_descr self)
 {
   /* See pthread.c */
-#if __ASSUME_REALTIME_SIGNALS
-  __pthread_wait_for_restart_signal(self);
+#if __ASSUME_FUTEX
+  __pthread_suspend_futex(self);
 #else
   __pthread_suspend(self);
 #endif
@@ -41,8 +41,8 @@ static inline int timedsuspend(pthread_descr self,
 		const struct timespec *abstime)
 {
   /* See pthread.c */
-#if __ASSUME_REALTIME_SIGNALS
-  return __pthread_timedsuspend_new(self, abstime);
+#if __ASSUME_FUTEX
+  return __pthread_timedsuspend_futex(self, abstime);
 #else
   return __pthread_timedsuspend(self, abstime);
 #endif
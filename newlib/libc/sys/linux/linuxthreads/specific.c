@@ -138,6 +138,11 @@ int __pthread_setspecific(pthread_key_t key, const void * pointer)
 
   if (key >= PTHREAD_KEYS_MAX || !pthread_keys[key].in_use)
     return EINVAL;
+  /* The first block is p_specific_first in the descriptor itself.  */
+  if (key < PTHREAD_KEY_2NDLEVEL_SIZE) {
+    THREAD_SETMEM_NC(self, p_specific_first[key], (void *) pointer);
+    return 0;
+  }
   idx1st = key / PTHREAD_KEY_2NDLEVEL_SIZE;
   idx2nd = key % PTHREAD_KEY_2NDLEVEL_SIZE;
   if (THREAD_GETMEM_NC(self, p_specific[idx1st]) == NULL) {
@@ -160,6 +165,9 @@ void * __pthread_getspecific(pthread_key_t key)
 
   if (key >= PTHREAD_KEYS_MAX)
     return NULL;
+  if (key < PTHREAD_KEY_2NDLEVEL_SIZE)
+    return pthread_keys[key].in_use
+	   ? THREAD_GETMEM_NC(self, p_specific_first[key]) : NULL;
   idx1st = key / PTHREAD_KEY_2NDLEVEL_SIZE;
   idx2nd = key % PTHREAD_KEY_2NDLEVEL_SIZE;
   if (THREAD_GETMEM_NC(self, p_specific[idx1st]) == NULL
@@ -195,7 +203,10 @@ void __pthread_destroy_specifics()
         }
   }
   __pthread_lock(THREAD_GETMEM(self, p_lock), self);
-  for (i = 0; i < PTHREAD_KEY_1STLEVEL_SIZE; i++) {
+  /* Block 0 is part of the descriptor.  */
+  for (j = 0; j < PTHREAD_KEY_2NDLEVEL_SIZE; j++)
+    THREAD_SETMEM_NC(self, p_specific_first[j], NULL);
+  for (i = 1; i < PTHREAD_KEY_1STLEVEL_SIZE; i++) {
     if (THREAD_GETMEM_NC(self, p_specific[i]) != NULL) {
       free(THREAD_GETMEM_NC(self, p_specific[i]));
       THREAD_SETMEM_NC(self, p_specific[i], NULL);
@@ -403,6 +403,43 @@ static void wait_node_dequeue(struct wait_node **pp_head,
   return;
 }
 
+/* On SMP, spin for a while before queueing on an alternate fastlock,
+   as __pthread_lock does. Only a free lock can be taken, so give up as
+   soon as other threads are queued. Returns 1 if the lock was taken. */
+
+static int __pthread_alt_spin(struct _pthread_fastlock * lock)
+{
+  long oldstatus;
+  int max_count, spin_count;
+
+  if (!__pthread_smp_kernel)
+    return 0;
+
+  max_count = lock->__spinlock * 2 + 10;
+  if (max_count > MAX_ADAPTIVE_SPIN_COUNT)
+    max_count = MAX_ADAPTIVE_SPIN_COUNT;
+
+  for (spin_count = 0; spin_count < max_count; spin_count++) {
+    oldstatus = lock->__status;
+    if (oldstatus == 0) {
+      if (__compare_and_swap(&lock->__status, 0, 1)) {
+	if (spin_count)
+	  lock->__spinlock += (spin_count - lock->__spinlock) / 8;
+	READ_MEMORY_BARRIER();
+	return 1;
+      }
+    } else if (oldstatus != 1)
+      return 0;
+#ifdef BUSY_WAIT_NOP
+    BUSY_WAIT_NOP;
+#endif
+    __asm __volatile ("" : "=m" (lock->__status) : "m" (lock->__status));
+  }
+
+  lock->__spinlock += (spin_count - lock->__spinlock) / 8;
+  return 0;
+}
+
 #endif
 
 void __pthread_alt_lock(struct _pthread_fastlock * lock,
@@ -443,6 +480,9 @@ void __pthread_alt_lock(struct _pthread_fastlock * lock,
 #endif
 
 #if defined HAS_COMPARE_AND_SWAP
+  if (__pthread_alt_spin(lock))
+    return;
+
   do {
     oldstatus = lock->__status;
     if (oldstatus == 0) {
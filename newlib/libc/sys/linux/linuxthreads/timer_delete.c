@@ -59,7 +59,7 @@ timer_delete (timerid)
 
       /* Remove timer from whatever queue it may be on and deallocate it.  */
       timer->inuse = TIMER_DELETED;
-      list_unlink_ip (&timer->links);
+      __timer_thread_dequeue_timer (timer);
       timer_delref (timer);
       retval = 0;
     }
@@ -24,6 +24,7 @@
 #include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h>
 #include <sysdep.h>
 #include <time.h>
 #include <unistd.h>
@@ -130,6 +131,20 @@ list_isempty (struct list_links *list)
   return list->next == list;
 }
 
+/* Move all nodes of LIST to the end of DEST.  */
+static inline void
+list_splice (struct list_links *list, struct list_links *dest)
+{
+  if (!list_isempty (list))
+    {
+      list->next->prev = dest->prev;
+      dest->prev->next = list->next;
+      list->prev->next = dest;
+      dest->prev = list->prev;
+      list_init (list);
+    }
+}
+
 
 /* Functions build on top of the list functions.  */
 static inline struct thread_node *
@@ -147,6 +162,235 @@ timer_links2ptr (struct list_links *list)
 }
 
 
+/* Timing wheel functions.  The global mutex must be held.  */
+static inline unsigned long long int
+timespec_ticks (const struct timespec *ts)
+{
+  if (ts->tv_sec < 0)
+    return 0;
+
+  return (((unsigned long long int) ts->tv_sec * 1000000000 + ts->tv_nsec)
+	  >> TIMER_TICK_SHIFT);
+}
+
+static inline void
+ticks_timespec (struct timespec *ts, unsigned long long int ticks)
+{
+  unsigned long long int ns = ticks << TIMER_TICK_SHIFT;
+
+  ts->tv_sec = ns / 1000000000;
+  ts->tv_nsec = ns % 1000000000;
+}
+
+/* Index of the lowest bit set in BITS, which must not be zero.  */
+static inline int
+lowest_bit (unsigned long long int bits)
+{
+  if ((unsigned int) bits != 0)
+    return ffs ((int) bits) - 1;
+
+  return ffs ((int) (bits >> 32)) + 31;
+}
+
+static void
+wheel_init (struct timer_wheel *wheel)
+{
+  int level, i;
+
+  wheel->now = 0;
+  wheel->count = 0;
+  for (level = 0; level < TIMER_WHEEL_LEVELS; ++level)
+    {
+      wheel->occupied[level] = 0;
+      for (i = 0; i < TIMER_WHEEL_SIZE; ++i)
+	list_init (&wheel->slot[level][i]);
+    }
+  list_init (&wheel->overflow);
+}
+
+/* Put TIMER in the slot for its expiry time relative to the current
+   tick of WHEEL.  Timers that are already overdue go to the current
+   slot.  */
+static void
+wheel_insert (struct timer_wheel *wheel, struct timer_node *timer)
+{
+  unsigned long long int tick = timespec_ticks (&timer->expirytime);
+  int level, shift, i;
+
+  if (tick < wheel->now)
+    tick = wheel->now;
+
+  for (level = 0, shift = 0; level < TIMER_WHEEL_LEVELS;
+       ++level, shift += TIMER_WHEEL_BITS)
+    if ((tick >> (shift + TIMER_WHEEL_BITS))
+	== (wheel->now >> (shift + TIMER_WHEEL_BITS)))
+      {
+	i = (tick >> shift) & (TIMER_WHEEL_SIZE - 1);
+	list_append (&wheel->slot[level][i], &timer->links);
+	wheel->occupied[level] |= 1ULL << i;
+	timer->wheel_slot = level * TIMER_WHEEL_SIZE + i;
+	return;
+      }
+
+  if (list_isempty (&wheel->overflow) || tick < wheel->overflow_min)
+    wheel->overflow_min = tick;
+  list_append (&wheel->overflow, &timer->links);
+  timer->wheel_slot = TIMER_WHEEL_OVERFLOW;
+}
+
+/* Find the next tick after the current one at which a slot of WHEEL
+   comes due: a level 0 slot holding timers, the start of a slot of a
+   higher level whose timers must be moved down, or the start of the
+   period of the first timer on the overflow list.  Returns 0 if there
+   is none, otherwise stores the tick in *TICK and its level in *LEVEL,
+   TIMER_WHEEL_LEVELS for the overflow list.  */
+static int
+wheel_next_event (struct timer_wheel *wheel, unsigned long long int *tick,
+		  int *level)
+{
+  unsigned long long int bits;
+  int shift, cur;
+
+  for (*level = 0, shift = 0; *level < TIMER_WHEEL_LEVELS;
+       ++*level, shift += TIMER_WHEEL_BITS)
+    {
+      cur = (wheel->now >> shift) & (TIMER_WHEEL_SIZE - 1);
+      if (cur == TIMER_WHEEL_SIZE - 1)
+	continue;
+
+      bits = wheel->occupied[*level] & (~0ULL << (cur + 1));
+      if (bits != 0)
+	{
+	  *tick = (((wheel->now >> (shift + TIMER_WHEEL_BITS))
+		    << (shift + TIMER_WHEEL_BITS))
+		   | ((unsigned long long int) lowest_bit (bits) << shift));
+	  return 1;
+	}
+    }
+
+  if (list_isempty (&wheel->overflow))
+    return 0;
+
+  *tick = (wheel->overflow_min >> shift) << shift;
+  return 1;
+}
+
+/* The current tick of WHEEL has just reached the start of some slots;
+   move their timers down to the levels they belong to now.  */
+static void
+wheel_cascade (struct timer_wheel *wheel)
+{
+  struct list_links pending;
+  struct list_links *node;
+  int level, shift, i;
+
+  list_init (&pending);
+
+  for (level = 1, shift = TIMER_WHEEL_BITS; level < TIMER_WHEEL_LEVELS;
+       ++level, shift += TIMER_WHEEL_BITS)
+    {
+      if ((wheel->now & ((1ULL << shift) - 1)) != 0)
+	break;
+
+      i = (wheel->now >> shift) & (TIMER_WHEEL_SIZE - 1);
+      list_splice (&wheel->slot[level][i], &pending);
+      wheel->occupied[level] &= ~(1ULL << i);
+    }
+
+  if ((wheel->now & ((1ULL << shift) - 1)) == 0)
+    list_splice (&wheel->overflow, &pending);
+
+  while (!list_isempty (&pending))
+    {
+      node = list_first (&pending);
+      list_unlink (node);
+      wheel_insert (wheel, timer_links2ptr (node));
+    }
+}
+
+/* Return the timer in a level 0 slot HEAD which expires first, among
+   those which are due at NOW if NOW is not NULL.  */
+static struct timer_node *
+slot_first (struct list_links *head, const struct timespec *now)
+{
+  struct list_links *iter;
+  struct timer_node *first = NULL;
+
+  for (iter = list_first (head); iter != list_null (head);
+       iter = list_next (iter))
+    {
+      struct timer_node *timer = timer_links2ptr (iter);
+
+      if ((now == NULL || timespec_compare (&timer->expirytime, now) <= 0)
+	  && (first == NULL
+	      || timespec_compare (&timer->expirytime,
+				   &first->expirytime) < 0))
+	first = timer;
+    }
+
+  return first;
+}
+
+/* Move WHEEL forward to NOW and return the first of its timers which
+   is due, or NULL if there is none.  */
+static struct timer_node *
+wheel_first_due (struct timer_wheel *wheel, const struct timespec *now)
+{
+  unsigned long long int target = timespec_ticks (now);
+  unsigned long long int tick;
+  struct timer_node *timer;
+  int level;
+
+  while (1)
+    {
+      timer = slot_first (&wheel->slot[0][wheel->now & (TIMER_WHEEL_SIZE - 1)],
+			  now);
+      if (timer != NULL || wheel->now >= target)
+	return timer;
+
+      if (! wheel_next_event (wheel, &tick, &level) || tick > target)
+	{
+	  wheel->now = target;
+	  return NULL;
+	}
+
+      wheel->now = tick;
+      wheel_cascade (wheel);
+    }
+}
+
+/* Compute in *WAKEUP when the thread serving WHEEL has to look at it
+   again: the expiry time of the first timer in the current or the next
+   level 0 slot, or else the start of the next slot which must be moved
+   down.  Returns 0 if WHEEL is empty.  */
+static int
+wheel_wakeup (struct timer_wheel *wheel, struct timespec *wakeup)
+{
+  unsigned long long int tick;
+  struct timer_node *timer;
+  int level;
+
+  timer = slot_first (&wheel->slot[0][wheel->now & (TIMER_WHEEL_SIZE - 1)],
+		      NULL);
+  if (timer == NULL && wheel_next_event (wheel, &tick, &level))
+    {
+      if (level != 0)
+	{
+	  ticks_timespec (wakeup, tick);
+	  return 1;
+	}
+      timer = slot_first (&wheel->slot[0][tick & (TIMER_WHEEL_SIZE - 1)],
+			  NULL);
+    }
+
+  if (timer == NULL)
+    return 0;
+
+  *wakeup = timer->expirytime;
+  return 1;
+}
+
+
 /* Initialize a newly allocated thread structure.  */
 static void
 thread_init (struct thread_node *thread, const pthread_attr_t *attr, clockid_t clock_id)
@@ -160,7 +404,8 @@ thread_init (struct thread_node *thread, const pthread_attr_t *attr, clockid_t c
     }
 
   thread->exists = 0;
-  list_init (&thread->timer_queue);
+  wheel_init (&thread->timer_queue);
+  thread->have_wakeup = 0;
   pthread_cond_init (&thread->cond, 0);
   thread->current_timer = 0;
   thread->captured = pthread_self ();
@@ -184,6 +429,7 @@ init_module (void)
     {
       list_append (&timer_free_list, &__timer_array[i].links);
       __timer_array[i].inuse = TIMER_FREE;
+      __timer_array[i].wheel_slot = -1;
     }
 
   for (i = 0; i < THREAD_MAXNODES; ++i)
@@ -228,7 +474,7 @@ __timer_init_once (void)
 static void
 thread_deinit (struct thread_node *thread)
 {
-  assert (list_isempty (&thread->timer_queue));
+  assert (thread->timer_queue.count == 0);
   pthread_cond_destroy (&thread->cond);
 }
 
@@ -296,7 +542,7 @@ thread_cleanup (void *val)
       /* We are no longer processing a timer event.  */
       thread->current_timer = 0;
 
-      if (list_isempty (&thread->timer_queue))
+      if (thread->timer_queue.count == 0)
 	  __timer_thread_dealloc (thread);
       else
 	(void) __timer_thread_start (thread);
@@ -387,30 +633,22 @@ thread_func (void *arg)
 
   while (1)
     {
-      struct list_links *first;
-      struct timer_node *timer = NULL;
+      struct timer_node *timer;
 
-      /* While the timer queue is not empty, inspect the first node.  */
-      first = list_first (&self->timer_queue);
-      if (first != list_null (&self->timer_queue))
+      if (self->timer_queue.count != 0)
 	{
 	  struct timespec now;
 
-	  timer = timer_links2ptr (first);
+	  /* This assumes that the timers of one thread are all for the
+	     same clock.  */
+	  clock_gettime (self->clock_id, &now);
 
-	  /* This assumes that the elements of the list of one thread
-	     are all for the same clock.  */
-	  clock_gettime (timer->clock, &now);
-
-	  while (1)
+	  /* Remove the timers which are due or overdue from the wheel in
+	     order.  If it's a periodic timer, re-compute its new time and
+	     requeue it.  Either way, perform the timer expiry. */
+	  while ((timer = wheel_first_due (&self->timer_queue, &now)) != NULL)
 	    {
-	      /* If the timer is due or overdue, remove it from the queue.
-		 If it's a periodic timer, re-compute its new time and
-		 requeue it.  Either way, perform the timer expiry. */
-	      if (timespec_compare (&now, &timer->expirytime) < 0)
-		break;
-
-	      list_unlink_ip (first);
+	      __timer_thread_dequeue_timer (timer);
 
 	      if (__builtin_expect (timer->value.it_interval.tv_sec, 0) != 0
 		  || timer->value.it_interval.tv_nsec != 0)
@@ -421,22 +659,16 @@ thread_func (void *arg)
 		}
 
 	      thread_expire_timer (self, timer);
-
-	      first = list_first (&self->timer_queue);
-	      if (first == list_null (&self->timer_queue))
-		break;
-
-	      timer = timer_links2ptr (first);
 	    }
 	}
 
-      /* If the queue is not empty, wait until the expiry time of the
-	 first node.  Otherwise wait indefinitely.  Insertions at the
-	 head of the queue must wake up the thread by broadcasting
-	 this condition variable.  */
-      if (timer != NULL)
-	pthread_cond_timedwait (&self->cond, &__timer_mutex,
-				&timer->expirytime);
+      /* If the wheel is not empty, wait until it next needs looking
+	 at.  Otherwise wait indefinitely.  Queueing a timer which
+	 expires earlier must wake up the thread by broadcasting this
+	 condition variable.  */
+      self->have_wakeup = wheel_wakeup (&self->timer_queue, &self->wakeup);
+      if (self->have_wakeup)
+	pthread_cond_timedwait (&self->cond, &__timer_mutex, &self->wakeup);
       else
 	pthread_cond_wait (&self->cond, &__timer_mutex);
     }
@@ -447,30 +679,46 @@ thread_func (void *arg)
 }
 
 
-/* Enqueue a timer in wakeup order in the thread's timer queue.
-   Returns 1 if the timer was inserted at the head of the queue,
-   causing the queue's next wakeup time to change. */
+/* Enqueue a timer in the thread's timing wheel.  Returns 1 if the
+   timer expires before the time the thread sleeps until, so that the
+   thread must be woken up. */
 
 int
 __timer_thread_queue_timer (struct thread_node *thread,
 			    struct timer_node *insert)
 {
-  struct list_links *iter;
-  int athead = 1;
+  wheel_insert (&thread->timer_queue, insert);
+  ++thread->timer_queue.count;
 
-  for (iter = list_first (&thread->timer_queue);
-       iter != list_null (&thread->timer_queue);
-        iter = list_next (iter))
-    {
-      struct timer_node *timer = timer_links2ptr (iter);
+  return (! thread->have_wakeup
+	  || timespec_compare (&insert->expirytime, &thread->wakeup) < 0);
+}
+
+
+/* Remove a timer from the timing wheel of its thread, if it is queued
+   there.  Global lock must be held by caller.  */
+void
+__timer_thread_dequeue_timer (struct timer_node *timer)
+{
+  struct timer_wheel *wheel;
+  int level, i;
+
+  if (timer->wheel_slot < 0)
+    return;
+
+  wheel = &timer->thread->timer_queue;
+  list_unlink_ip (&timer->links);
 
-      if (timespec_compare (&insert->expirytime, &timer->expirytime) < 0)
-	  break;
-      athead = 0;
+  if (timer->wheel_slot != TIMER_WHEEL_OVERFLOW)
+    {
+      level = timer->wheel_slot / TIMER_WHEEL_SIZE;
+      i = timer->wheel_slot % TIMER_WHEEL_SIZE;
+      if (list_isempty (&wheel->slot[level][i]))
+	wheel->occupied[level] &= ~(1ULL << i);
     }
 
-  list_insbefore (iter, &insert->links);
-  return athead;
+  --wheel->count;
+  timer->wheel_slot = -1;
 }
 
 
@@ -532,10 +780,7 @@ __timer_thread_find_matching (const pthread_attr_t *desired_attr,
 
       if (thread_attr_compare (desired_attr, &candidate->attr)
 	  && desired_clock_id == candidate->clock_id)
-	{
-	  list_unlink (iter);
-	  return candidate;
-        }
+	return candidate;
 
       iter = list_next (iter);
     }
@@ -101,7 +101,7 @@ timer_settime (timerid, flags, value, ovalue)
 
   timer->value = *value;
 
-  list_unlink_ip (&timer->links);
+  __timer_thread_dequeue_timer (timer);
   timer->armed = 0;
 
   thread = timer->thread;
@@ -116,8 +116,8 @@ timer_settime (timerid, flags, value, ovalue)
       else
 	timespec_add (&timer->expirytime, &now, &value->it_value);
 
-      /* Only need to wake up the thread if timer is inserted
-	 at the head of the queue. */
+      /* Only need to wake up the thread if the timer expires before
+	 the time it sleeps until. */
       if (thread != NULL)
 	need_wakeup = __timer_thread_queue_timer (thread, timer);
       timer->armed = 1;
@@ -2,11 +2,7 @@
 
 #include <mqueue.h>
 #include <errno.h>
-#include <sys/sem.h>
 #include <string.h>
-#define _LIBC 1
-#include <sys/lock.h>
-#undef _LIBC
 
 #include "mqlocal.h"
 
@@ -14,9 +10,7 @@ int
 mq_getattr (mqd_t msgid, struct mq_attr *mqstat)
 {
   struct libc_mq *info;
-  struct sembuf sb0 = {0, -1, 0};
-  int num_msgs;
-  int rc = 0;
+  struct mq_hdr *hdr;
 
   info = __find_mq (msgid);
 
@@ -26,27 +20,18 @@ mq_getattr (mqd_t msgid, struct mq_attr *mqstat)
       return -1;
     }
 
+  hdr = info->hdr;
+
   /* temporarily lock message queue */
-  semop (info->semid, &sb0, 1);
+  __mq_lock (hdr);
 
-  num_msgs = semctl (info->semid, 3, GETVAL);
-  if (num_msgs >= 0)
-    {
-      memcpy (mqstat, info->attr, sizeof(struct mq_attr));
-      mqstat->mq_curmsgs = num_msgs;
-    }
-  else
-    rc = -1;
+  mqstat->mq_flags = info->flags;
+  mqstat->mq_maxmsg = hdr->maxmsg;
+  mqstat->mq_msgsize = hdr->msgsize;
+  mqstat->mq_curmsgs = hdr->curmsgs;
 
   /* release message queue */
-  sb0.sem_op = 1;
-  semop (info->semid, &sb0, 1);
+  __mq_unlock (hdr);
 
-  return rc;
+  return 0;
 }
-      
-
-
-
-
-
@@ -4,15 +4,17 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <errno.h>
+#include <limits.h>
+#include <sched.h>
 #include <sys/stat.h>
 #include <sys/mman.h>
-#include <sys/ipc.h>
-#include <sys/sem.h>
 #include <string.h>
 #include <stdlib.h>
 #include <time.h>
 #include <stdarg.h>
 #include <machine/weakalias.h>
+#include <machine/syscall.h>
+#include <machine/atomic.h>
 #define _LIBC 1
 #include <sys/lock.h>
 #undef _LIBC
@@ -27,31 +29,125 @@ static struct	libc_mq *mq_hash[NHASH];   /* Hash list heads for mqopen_infos */
 
 __LOCK_INIT(static, mq_hash_lock);
 
+#ifdef __NR_futex
+/* Futex operations, see <linux/futex.h>.  */
+#define FUTEX_WAIT	0
+#define FUTEX_WAKE	1
+
+static _syscall4_base(int,futex,volatile int *,uaddr,int,op,int,val,const struct timespec *,timeout)
+#endif
+
+/* Sleep while *ADDR is VAL.  Returns 0 or an errno value; spurious
+   wakeups are possible.  Without futexes just yield the processor.  */
+static int
+mq_futex_wait (volatile int *addr, int val)
+{
+  int saved_errno = errno;
+  int err = 0;
+
+#ifdef __NR_futex
+  if (__libc_futex (addr, FUTEX_WAIT, val, NULL) == 0)
+    return 0;
+  err = errno;
+  errno = saved_errno;
+  if (err != ENOSYS)
+    return err == EWOULDBLOCK ? 0 : err;
+  err = 0;
+#endif
+  sched_yield ();
+  errno = saved_errno;
+  return err;
+}
+
+static void
+mq_futex_wake (volatile int *addr, int nr)
+{
+#ifdef __NR_futex
+  int saved_errno = errno;
+
+  __libc_futex (addr, FUTEX_WAKE, nr, NULL);
+  errno = saved_errno;
+#endif
+}
+
+/* The queue lock: 0 is free, 1 locked, 2 locked with waiters.  */
+void
+__mq_lock (struct mq_hdr *hdr)
+{
+  int c;
+
+  c = __arch_compare_and_exchange_val_32_acq (&hdr->lock, 1, 0);
+  if (c == 0)
+    return;
+  if (c != 2)
+    c = atomic_exchange_acq (&hdr->lock, 2);
+  while (c != 0)
+    {
+      mq_futex_wait (&hdr->lock, 2);
+      c = atomic_exchange_acq (&hdr->lock, 2);
+    }
+}
+
+void
+__mq_unlock (struct mq_hdr *hdr)
+{
+  if (atomic_exchange_and_add (&hdr->lock, -1) != 1)
+    {
+      hdr->lock = 0;
+      mq_futex_wake (&hdr->lock, 1);
+    }
+}
+
+/* Called with the queue locked: drop the lock, sleep until SEQ moves
+   and take the lock again.  NWAIT counts the sleepers so that the other
+   side only makes the wake-up system call when somebody waits.  Returns
+   -1 with errno EINTR if a signal interrupted the wait.  */
+int
+__mq_wait (struct mq_hdr *hdr, volatile int *seq, int *nwait)
+{
+  int val = *seq;
+  int err;
+
+  ++*nwait;
+  __mq_unlock (hdr);
+  err = mq_futex_wait (seq, val);
+  __mq_lock (hdr);
+  --*nwait;
+  if (err == EINTR)
+    {
+      errno = EINTR;
+      return -1;
+    }
+  return 0;
+}
+
+void
+__mq_wake (volatile int *seq, int nr)
+{
+  mq_futex_wake (seq, nr);
+}
+
 mqd_t
 mq_open (const char *name, int oflag, ...)
 {
-  MSG *wrbuf = NULL;
-  MSG *rdbuf = NULL;
-  int msgqid = -1;
-  int rc = -1;
+  struct mq_hdr *hdr = (struct mq_hdr *)MAP_FAILED;
+  struct mq_attr *user_attr = NULL;
+  struct stat st;
+  struct timespec tms;
+  mode_t mode = 0;
+  size_t mapsize = 0;
+  long maxmsg, msgsize, slotsize;
   int fd = -1;
-  int semid = -1;
   int created = 0;
-  key_t key = (key_t)-1;
-  struct mq_attr *attr = (struct mq_attr *)MAP_FAILED;
-  struct sembuf sb = {0, 0, 0};
-  mode_t mode = 0;
   int size;
   int i, index, saved_errno;
   char *real_name;
   char *ptr;
-  struct mq_attr *user_attr = NULL;
   struct libc_mq *info;
-  union semun arg;
-  
+
   /* ignore opening slash if present */
   if (*name == '/')
-    ++name;  
+    ++name;
   size = strlen(name);
 
   if ((real_name = (char *)malloc (size + sizeof(MSGQ_PREFIX))) == NULL ||
@@ -62,7 +158,7 @@ mq_open (const char *name, int oflag, ...)
 	free (real_name);
       return (mqd_t)-1;
     }
-  
+
   /* use given name to create shared memory file name - we convert any
      slashes to underscores so we don't have to create directories */
   memcpy (real_name, MSGQ_PREFIX, sizeof(MSGQ_PREFIX) - 1);
@@ -75,8 +171,7 @@ mq_open (const char *name, int oflag, ...)
       ++ptr;
     }
 
-  /* open shared memory file based on msg queue open flags and then use memory
-     file to create a unique key to use for semaphores, etc.. */
+  /* open shared memory file based on msg queue open flags */
   if (oflag & O_CREAT)
     {
       va_list list;
@@ -102,175 +197,108 @@ mq_open (const char *name, int oflag, ...)
       if (fd >= 0)
         created = 1;
     }
-	  
-  if (fd < 0)
-    fd = open (real_name, O_RDWR, 0);
-
-  if (fd >= 0)
-    key = ftok(real_name, 255);
 
-  if (key != (key_t)-1)
-    /* memory map the shared memory file so we have a global shared data area to use */
-    attr = (struct mq_attr *)mmap (0, sizeof(struct mq_attr), PROT_READ | PROT_WRITE,
-				   MAP_SHARED, fd, 0);
-  
-  if (attr != (struct mq_attr *)MAP_FAILED)
+  if (created)
     {
-      /* we need semaphores to prevent multi-process race conditions on the
-	 shared storage which contains a shared structure.  The following
-	 are the ones we need.
-	 
-	 0 = open semaphore
-	 1 = number of opens
-	 2 = number of writes left until queue is full
-	 3 = number of reads available in queue
-	 4 = notify semaphore 
-	 5 = number of readers */
-      arg.val = 0;
-      /* make sure the creator of the shared memory file also is the creator of the
-	 semaphores...this will ensure that it also creates the message queue */
-      if (created)
+      /* size the file for the header and the message slots, then
+	 set the queue up; MQ_MAGIC tells other openers it is ready */
+      maxmsg = user_attr ? user_attr->mq_maxmsg : MQ_DEFAULT_MAXMSG;
+      msgsize = user_attr ? user_attr->mq_msgsize : MQ_DEFAULT_MSGSIZE;
+      if (maxmsg <= 0 || msgsize <= 0 || maxmsg > INT_MAX
+	  || msgsize > (long)((LONG_MAX - sizeof(struct mq_hdr)) / maxmsg)
+		       - (long)(2 * sizeof(struct mq_msg)))
 	{
-	  saved_errno = errno;
-	  semid = semget (key, 6, IPC_CREAT | IPC_EXCL | mode);
-	  errno = saved_errno;
-	  /* now that we have created the semaphore, we should initialize it */
-	  if (semid != -1)
-	    semctl (semid, 0, SETVAL, arg);
+	  errno = EINVAL;
+	  goto fail;
 	}
-      else
-	{
-	  /* if we didn't create the shared memory file but have gotten to here, we want
-	     to ensure we haven't gotten ahead of the creator temporarily so we will
-	     loop until the semaphore exists.  This ensures that the creator will be the
-	     one to create the message queue with the correct mode and we will be blocked
-	     by the open semaphore 0.  We impose a time limit to ensure something terrible
-	     hasn't gone wrong. */
-	  struct timespec tms;
-	  int i;
-
-	  tms.tv_sec = 0;
-	  tms.tv_nsec = 10000; /* 10 microseconds */
-	  for (i = 0; i < 100; ++i)
-	    {
-	      if ((semid = semget (key, 6, 0)) != -1)
-		break;
-	      /* sleep in case we our a higher priority process */
-	      nanosleep (&tms, NULL);
-	    }
-	}
-    }
-
-  if (semid != -1)
-    {
-      /* acquire main open semaphore if we didn't create it */
-      if (!created)
-	{
-	  sb.sem_op = -1;
-	  rc = semop (semid, &sb, 1);
-	}
-      else
-	rc = 0; /* need this to continue below */
+      slotsize = MQ_SLOTSIZE (msgsize);
+      mapsize = sizeof(struct mq_hdr) + maxmsg * slotsize;
+      if (ftruncate (fd, mapsize) < 0)
+	goto fail;
+      hdr = (struct mq_hdr *)mmap (0, mapsize, PROT_READ | PROT_WRITE,
+				   MAP_SHARED, fd, 0);
+      if (hdr == (struct mq_hdr *)MAP_FAILED)
+	goto fail;
+      hdr->maxmsg = maxmsg;
+      hdr->msgsize = msgsize;
+      hdr->slotsize = slotsize;
+      for (i = 0; i < MQ_PRIO_MAX; ++i)
+	hdr->head[i] = hdr->tail[i] = -1;
+      for (i = 0; i < maxmsg; ++i)
+	MQ_SLOT (hdr, i)->next = i + 1 < maxmsg ? i + 1 : -1;
+      hdr->free = 0;
+      atomic_exchange_acq (&hdr->magic, MQ_MAGIC);
     }
-      
-  if (rc == 0)
+  else
     {
-      if (created)
+      if (fd < 0)
+	fd = open (real_name, O_RDWR, 0);
+      if (fd < 0)
+	goto fail;
+
+      /* we may have gotten ahead of the creator, so wait a little for it
+	 to size and initialize the queue.  We impose a time limit to ensure
+	 something terrible hasn't gone wrong. */
+      tms.tv_sec = 0;
+      tms.tv_nsec = 10000; /* 10 microseconds */
+      for (i = 0; i < 1000; ++i)
 	{
-	  /* the creator must get here first so the message queue will be created */
-	  msgqid = msgget (key, IPC_CREAT | mode); 
-	  if (msgqid >= 0)
+	  if (fstat (fd, &st) < 0)
+	    goto fail;
+	  if (hdr == (struct mq_hdr *)MAP_FAILED
+	      && st.st_size >= sizeof(struct mq_hdr))
 	    {
-	      /* we have created the message queue so check and set the attributes */
-	      if ((wrbuf = (MSG *)malloc (user_attr->mq_msgsize + sizeof(int))) == NULL ||
-		  (rdbuf = (MSG *)malloc (user_attr->mq_msgsize + sizeof(int))) == NULL ||
-		  user_attr == NULL || user_attr->mq_msgsize <= 0 || user_attr->mq_maxmsg <= 0)
-		{
-		  /* we're out of space and we created the message queue so we should
-		     try to remove it */
-		  msgctl (msgqid, IPC_RMID, NULL);
-		  msgqid = -1; /* allow clean up to occur below */
-		  if (wrbuf && rdbuf)
-		    errno = EINVAL;
-		  else
-		    errno = ENOSPC;
-		}
-	      else /* valid attributes */
-		{
-		  write (fd, user_attr, sizeof(struct mq_attr));
-		  attr->mq_curmsgs = 0;
-		  attr->mq_flags = oflag & O_NONBLOCK;
-		  arg.val = 0;
-		  semctl (semid, 1, SETVAL, arg); /* number of opens starts at 0 */
-		  semctl (semid, 3, SETVAL, arg); /* number of reads available starts at 0 */
-		  semctl (semid, 5, SETVAL, arg); /* number of readers starts at 0 */
-		  arg.val = 1;
-		  semctl (semid, 4, SETVAL, arg); /* notify semaphore */
-		  arg.val = user_attr->mq_maxmsg;
-		  semctl (semid, 2, SETVAL, arg); /* number of writes left starts at mq_maxmsg */
-		}
+	      mapsize = st.st_size;
+	      hdr = (struct mq_hdr *)mmap (0, mapsize, PROT_READ | PROT_WRITE,
+					   MAP_SHARED, fd, 0);
+	      if (hdr == (struct mq_hdr *)MAP_FAILED)
+		goto fail;
 	    }
+	  if (hdr != (struct mq_hdr *)MAP_FAILED && hdr->magic == MQ_MAGIC)
+	    break;
+	  nanosleep (&tms, NULL);
 	}
-      else /* just open it */
-        {
-	  msgqid = msgget (key, 0);
-	  wrbuf = (MSG *)malloc (attr->mq_msgsize + sizeof(int));
-	  rdbuf = (MSG *)malloc (attr->mq_msgsize + sizeof(int));
-        }
-      
-      /* release semaphore acquired earlier */
-      sb.sem_op = 1;
-      semop (semid, &sb, 1);
-    }
-
-  /* if we get here and we haven't got a message queue id, then we need to clean up 
-     our mess and return failure */
-  if (msgqid < 0)
-    {
-      if (fd >= 0)
-	close (fd);
-      if (attr != (struct mq_attr *)MAP_FAILED)
-	munmap (attr, sizeof(struct mq_attr));
-      if (created)
+      if (hdr == (struct mq_hdr *)MAP_FAILED || hdr->magic != MQ_MAGIC
+	  || mapsize != sizeof(struct mq_hdr) + hdr->maxmsg * hdr->slotsize)
 	{
-	  unlink (real_name);
-	  if (semid != -1)
-	    semctl (semid, 0, IPC_RMID);
+	  errno = EACCES;
+	  goto fail;
 	}
-      free (real_name);
-      free (info);
-      if (wrbuf)
-	free (wrbuf);
-      if (rdbuf)
-	free (rdbuf);
-      return (mqd_t)-1;
     }
 
-  /* we are successful so register the message queue */
+  /* the mapping keeps the queue, we don't need the file any more */
+  close (fd);
 
-  /* up the count of msg queue opens */
-  sb.sem_op = 1;
-  sb.sem_num = 1;
-  semop (semid, &sb, 1);
-
-  /* success, translate into index into mq_info array */  
+  /* success, translate into index into mq_info array */
   __lock_acquire(mq_hash_lock);
   index = mq_index++;
   info->index = index;
-  info->msgqid = msgqid;
   info->name = real_name;
-  info->semid = semid;
-  info->fd = fd;
   info->oflag = oflag;
-  info->wrbuf = wrbuf;
-  info->rdbuf = rdbuf;
+  info->flags = oflag & O_NONBLOCK;
+  info->hdr = hdr;
+  info->mapsize = mapsize;
   info->cleanup_notify = NULL;
   info->next = mq_hash[LOCHASH(index)];
-  info->attr = attr;
   mq_hash[LOCHASH(index)] = info;
   __lock_release(mq_hash_lock);
 
   return (mqd_t)index;
+
+  /* if we get here we haven't got a message queue, so we need to clean
+     up our mess and return failure */
+ fail:
+  saved_errno = errno;
+  if (hdr != (struct mq_hdr *)MAP_FAILED)
+    munmap (hdr, mapsize);
+  if (fd >= 0)
+    close (fd);
+  if (created)
+    unlink (real_name);
+  free (real_name);
+  free (info);
+  errno = saved_errno;
+  return (mqd_t)-1;
 }
 
 struct libc_mq *
@@ -293,14 +321,12 @@ __find_mq (mqd_t mq)
 
   return ptr;
 }
-      
+
 void
 __cleanup_mq (mqd_t mq)
 {
   struct libc_mq *ptr;
   struct libc_mq *prev;
-  int semid;
-  struct sembuf sb = {0, 0, 0};
 
   __lock_acquire(mq_hash_lock);
 
@@ -317,30 +343,22 @@ __cleanup_mq (mqd_t mq)
 
   if (ptr != NULL)
     {
-      if (ptr->cleanup_notify != NULL)
-	ptr->cleanup_notify (ptr);
       if (prev != NULL)
 	prev->next = ptr->next;
       else
-	mq_hash[LOCHASH((int)mq)] = NULL;
-      munmap (ptr->attr, sizeof(struct mq_attr));
-      close (ptr->fd);
-      free (ptr->name);
-      free (ptr->wrbuf);
-      free (ptr->rdbuf);
-      semid = ptr->semid;
-      free (ptr);
-      /* lower the count of msg queue opens */
-      sb.sem_op = -1;
-      sb.sem_num = 1;
-      sb.sem_flg = IPC_NOWAIT;
-      semop (semid, &sb, 1);
+	mq_hash[LOCHASH((int)mq)] = ptr->next;
     }
 
   __lock_release(mq_hash_lock);
-}
-
-
-
-
 
+  /* the notification thread may itself need the hash lock, so it is
+     stopped only once the entry is unreachable */
+  if (ptr != NULL)
+    {
+      if (ptr->cleanup_notify != NULL)
+	ptr->cleanup_notify (ptr);
+      munmap (ptr->hdr, ptr->mapsize);
+      free (ptr->name);
+      free (ptr);
+    }
+}
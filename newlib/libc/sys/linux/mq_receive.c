@@ -3,26 +3,19 @@
 #include <mqueue.h>
 #include <fcntl.h>
 #include <errno.h>
-#include <sys/ipc.h>
-#include <sys/sem.h>
 #include <string.h>
-#define _LIBC 1
-#include <sys/lock.h>
-#undef _LIBC
 
 #include "mqlocal.h"
 
-__LOCK_INIT(static, mq_rdbuf_lock);
-
 ssize_t
 mq_receive (mqd_t msgid, char *msg, size_t msg_len, unsigned int *msg_prio)
 {
   struct libc_mq *info;
-  struct sembuf sb2 = {2, 1, 0};
-  struct sembuf sb3 = {3, -1, IPC_NOWAIT};
-  struct sembuf sb5 = {5, 1, IPC_NOWAIT};
+  struct mq_hdr *hdr;
+  struct mq_msg *slot;
   ssize_t num_bytes;
-  int ipcflag;
+  int prio, index;
+  int wake_send = 0;
 
   info = __find_mq (msgid);
 
@@ -32,36 +25,60 @@ mq_receive (mqd_t msgid, char *msg, size_t msg_len, unsigned int *msg_prio)
       return -1;
     }
 
-  if (msg_len < info->attr->mq_msgsize)
+  hdr = info->hdr;
+
+  if (msg_len < hdr->msgsize)
     {
       errno = EMSGSIZE;
       return -1;
     }
 
-  __lock_acquire (mq_rdbuf_lock);
-
-  ipcflag = (info->attr->mq_flags & O_NONBLOCK) ? IPC_NOWAIT : 0;
-
-  semop (info->semid, &sb5, 1); /* increase number of readers */
-  num_bytes = msgrcv (info->msgqid, info->rdbuf, msg_len, -MQ_PRIO_MAX, ipcflag);
-  sb5.sem_op = -1;
-  semop (info->semid, &sb5, 1); /* decrease number of readers */
+  __mq_lock (hdr);
 
-  if (num_bytes != (ssize_t)-1)
+  /* wait until there is a message */
+  while (hdr->curmsgs == 0)
     {
-      semop (info->semid, &sb2, 1); /* add one to messages left to write */
-      semop (info->semid, &sb3, 1); /* subtract one from messages to read */
-      memcpy (msg, info->rdbuf->text, num_bytes);
-      if (msg_prio != NULL)
-	*msg_prio = MQ_PRIO_MAX - info->rdbuf->type;
+      if (info->flags & O_NONBLOCK)
+	{
+	  __mq_unlock (hdr);
+	  errno = EAGAIN;
+	  return -1;
+	}
+      if (__mq_wait (hdr, &hdr->sendseq, &hdr->nrecvwait) != 0)
+	{
+	  __mq_unlock (hdr);
+	  return -1;
+	}
     }
-  
-  __lock_release (mq_rdbuf_lock);
-  return num_bytes;
-}
-      
-
-
 
+  /* the oldest message of the highest priority */
+  for (prio = MQ_PRIO_MAX - 1; !(hdr->nonempty & (1 << prio)); --prio)
+    ;
+  index = hdr->head[prio];
+  slot = MQ_SLOT (hdr, index);
+  hdr->head[prio] = slot->next;
+  if (slot->next < 0)
+    {
+      hdr->tail[prio] = -1;
+      hdr->nonempty &= ~(1 << prio);
+    }
+  num_bytes = slot->len;
+  memcpy (msg, slot->text, num_bytes);
+  if (msg_prio != NULL)
+    *msg_prio = slot->prio;
+  slot->next = hdr->free;
+  hdr->free = index;
+  hdr->curmsgs--;
+
+  if (hdr->nsendwait > 0)
+    {
+      hdr->recvseq++;
+      wake_send = 1;
+    }
 
+  __mq_unlock (hdr);
 
+  if (wake_send)
+    __mq_wake (&hdr->recvseq, 1);
+  return num_bytes;
+}
@@ -3,26 +3,20 @@
 #include <mqueue.h>
 #include <fcntl.h>
 #include <errno.h>
-#include <sys/ipc.h>
-#include <sys/sem.h>
 #include <string.h>
 #include <stdlib.h>
-#define _LIBC 1
-#include <sys/lock.h>
-#undef _LIBC
 
 #include "mqlocal.h"
 
-__LOCK_INIT(static, mq_wrbuf_lock);
-
 int
 mq_send (mqd_t msgid, const char *msg, size_t msg_len, unsigned int msg_prio)
 {
   struct libc_mq *info;
-  struct sembuf sb2 = {2, -1, 0};
-  struct sembuf sb3 = {3, 1, 0};
-  int rc;
-  int ipcflag;
+  struct mq_hdr *hdr;
+  struct mq_msg *slot;
+  int index;
+  int wake_recv = 0;
+  int wake_notify = 0;
 
   info = __find_mq (msgid);
 
@@ -32,41 +26,73 @@ mq_send (mqd_t msgid, const char *msg, size_t msg_len, unsigned int msg_prio)
       return -1;
     }
 
-  if (msg_len > info->attr->mq_msgsize)
+  hdr = info->hdr;
+
+  if (msg_len > hdr->msgsize)
     {
       errno = EMSGSIZE;
       return -1;
     }
 
-  if (msg_prio > MQ_PRIO_MAX)
+  if (msg_prio >= MQ_PRIO_MAX)
     {
       errno = EINVAL;
       return -1;
     }
 
-  __lock_acquire (mq_wrbuf_lock);
-
-  memcpy (info->wrbuf->text, msg, msg_len);
-  info->wrbuf->type = (MQ_PRIO_MAX - msg_prio);
-
-  ipcflag = (info->attr->mq_flags & O_NONBLOCK) ? IPC_NOWAIT : 0;
-  sb2.sem_flg = ipcflag;
+  __mq_lock (hdr);
 
-  /* check to see if max msgs are on queue */
-  rc = semop (info->semid, &sb2, 1);
+  /* wait until there is room on the queue */
+  while (hdr->curmsgs >= hdr->maxmsg)
+    {
+      if (info->flags & O_NONBLOCK)
+	{
+	  __mq_unlock (hdr);
+	  errno = EAGAIN;
+	  return -1;
+	}
+      if (__mq_wait (hdr, &hdr->recvseq, &hdr->nsendwait) != 0)
+	{
+	  __mq_unlock (hdr);
+	  return -1;
+	}
+    }
 
-  if (rc == 0)
-    rc = msgsnd (info->msgqid, info->wrbuf, msg_len, ipcflag);
+  /* take a free slot and append it to the list of its priority */
+  index = hdr->free;
+  slot = MQ_SLOT (hdr, index);
+  hdr->free = slot->next;
+  memcpy (slot->text, msg, msg_len);
+  slot->len = msg_len;
+  slot->prio = msg_prio;
+  slot->next = -1;
+  if (hdr->tail[msg_prio] < 0)
+    hdr->head[msg_prio] = index;
+  else
+    MQ_SLOT (hdr, hdr->tail[msg_prio])->next = index;
+  hdr->tail[msg_prio] = index;
+  hdr->nonempty |= 1 << msg_prio;
+
+  /* a blocked receiver gets the message; otherwise a message arriving
+     on an empty queue fires the notification, which also removes it */
+  if (hdr->nrecvwait > 0)
+    {
+      hdr->sendseq++;
+      wake_recv = 1;
+    }
+  else if (hdr->curmsgs == 0 && hdr->notify_pid != 0)
+    {
+      hdr->notify_pid = 0;
+      hdr->notifyseq++;
+      wake_notify = 1;
+    }
+  hdr->curmsgs++;
 
-  if (rc == 0)
-    semop (info->semid, &sb3, 1);  /* increment number of reads */
+  __mq_unlock (hdr);
 
-  __lock_release (mq_wrbuf_lock);
-  return rc;
+  if (wake_recv)
+    __mq_wake (&hdr->sendseq, 1);
+  if (wake_notify)
+    __mq_wake (&hdr->notifyseq, 1);
+  return 0;
 }
-      
-
-
-
-
-
@@ -2,17 +2,9 @@
 
 #include <mqueue.h>
 #include <errno.h>
-#include <fcntl.h>
-#include <sys/stat.h>
-#include <sys/mman.h>
-#include <sys/ipc.h>
-#include <sys/sem.h>
 #include <string.h>
 #include <stdlib.h>
-#include <machine/weakalias.h>
-#define _LIBC 1
-#include <sys/lock.h>
-#undef _LIBC
+#include <unistd.h>
 
 #include "mqlocal.h"
 
@@ -20,12 +12,9 @@ int
 mq_unlink (const char *name)
 {
   int size;
-  int saved_errno;
   char *real_name;
   char *ptr;
   int i, rc;
-  int semid, msgqid;
-  key_t key;
   
   /* ignore opening slash if present */
   if (*name == '/')
@@ -50,24 +39,9 @@ mq_unlink (const char *name)
       ++ptr;
     }
 
-  /* get key and then unlink shared memory file */
-  if ((key = ftok(real_name, 255)) == (key_t)-1)
-    return -1;
-
+  /* processes which have the queue open keep their mapping of it */
   rc = unlink (real_name);
-
-  if (rc == 0)
-    {
-      /* try to remove semaphore and msg queues associated with shared memory file */
-      saved_errno = errno;
-      semid = semget (key, 6, 0);
-      if (semid != -1)
-	semctl (semid, 0, IPC_RMID);
-      msgqid = msgget (key, 0);
-      if (msgqid != -1)
-	msgctl (msgqid, IPC_RMID, NULL);
-      errno = saved_errno;
-    }
+  free (real_name);
 
   return rc;
 }
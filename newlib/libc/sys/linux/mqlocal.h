@@ -1,40 +1,77 @@
 /* local definitions needed by mq routines */
 
-#include <sys/msg.h>
+#include <sys/types.h>
 #include <signal.h>
+#include <stddef.h>
 
-/* a message */
-typedef struct
-{
-  unsigned int type;
-  char text[1];
-} MSG; 
+/*
+ * A message queue is a file under MSGQ_PREFIX which every process that
+ * opens the queue maps shared.  It holds a struct mq_hdr followed by
+ * mq_maxmsg message slots.  Queued messages are kept in one list per
+ * priority; unused slots are on a free list.  All fields are protected
+ * by the lock word in the header, a futex based mutex, so an uncontended
+ * mq_send or mq_receive makes no system call at all.  Blocked senders
+ * and receivers sleep on futex sequence words that are bumped whenever
+ * a message is removed or added.
+ */
+
+#define MQ_MAGIC	0x6d713031	/* "mq01", set once the queue is ready */
 
-union semun {
-  int val;
-  struct semid_ds *buf;
-  unsigned short  *array;
-} arg;
+/* Used when mq_open creates a queue without attributes.  */
+#define MQ_DEFAULT_MAXMSG	10
+#define MQ_DEFAULT_MSGSIZE	8192
+
+struct mq_hdr {
+  volatile int     magic;          /* MQ_MAGIC once initialized */
+  volatile int     lock;           /* 0 free, 1 locked, 2 contended */
+  long             maxmsg;         /* mq_maxmsg */
+  long             msgsize;        /* mq_msgsize */
+  long             slotsize;       /* bytes per message slot */
+  long             curmsgs;        /* number of messages queued */
+  unsigned int     nonempty;       /* bit p set if priority p has messages */
+  int              head[MQ_PRIO_MAX]; /* oldest message of each priority */
+  int              tail[MQ_PRIO_MAX]; /* newest message of each priority */
+  int              free;           /* first free slot */
+  volatile int     sendseq;        /* bumped when a message is added */
+  volatile int     recvseq;        /* bumped when a message is removed */
+  int              nsendwait;      /* senders waiting for room */
+  int              nrecvwait;      /* receivers waiting for a message */
+  volatile int     notifyseq;      /* bumped when a notification fires */
+  pid_t            notify_pid;     /* registered for mq_notify, or 0 */
+};
+
+/* a message slot, -1 ends the lists */
+struct mq_msg {
+  int              next;
+  unsigned int     prio;
+  size_t           len;
+  char             text[1];
+};
+
+#define MQ_SLOTSIZE(msgsize) \
+  ((offsetof (struct mq_msg, text) + (msgsize) + sizeof (long) - 1) \
+   & ~(sizeof (long) - 1))
+#define MQ_SLOT(hdr, i) \
+  ((struct mq_msg *) ((char *) ((hdr) + 1) + (i) * (hdr)->slotsize))
 
 /*
  * One of these structures is malloced to describe any open message queue
- * each time mq_open is called. 
+ * each time mq_open is called.
  */
 
 struct libc_mq;
 
 struct libc_mq {
   int              index;          /* index of this message queue */
-  int              msgqid;         /* value returned by msgget */
-  int              semid;          /* semaphore id */
-  int              fd;             /* fd of shared memory file */
   int              oflag;          /* original open flag used */
-  int              th;             /* thread id for mq_notify */
+  long             flags;          /* mq_flags of this descriptor */
+  unsigned long    th;             /* thread id for mq_notify */
+  int              notifyseq;      /* hdr->notifyseq when registered */
+  volatile int     notify_stop;    /* tells the mq_notify thread to quit */
   char            *name;           /* name used */
-  MSG             *wrbuf;          /* msg write buffer */
-  MSG             *rdbuf;          /* msg read buffer */
-  struct mq_attr  *attr;           /* pointer to attribute structure */
-  struct sigevent *sigevent;       /* used for mq_notify */
+  struct mq_hdr   *hdr;            /* the shared queue */
+  size_t           mapsize;        /* size of the mapping */
+  struct sigevent  sigevent;       /* used for mq_notify */
   void (*cleanup_notify)(struct libc_mq *); /* also used for mq_notify */
   struct libc_mq  *next;           /* next info struct in hash table */
 };
@@ -43,5 +80,11 @@ extern struct libc_mq *__find_mq (mqd_t mq);
 extern void __cleanup_mq (mqd_t mq);
 extern void __cleanup_mq_notify (struct libc_mq *ptr);
 
+/* mq_open.c: the lock and the waits on a queue header */
+extern void __mq_lock (struct mq_hdr *hdr);
+extern void __mq_unlock (struct mq_hdr *hdr);
+extern int __mq_wait (struct mq_hdr *hdr, volatile int *seq, int *nwait);
+extern void __mq_wake (volatile int *seq, int nr);
+
 #define MSGQ_PREFIX "/dev/shm/__MSGQ__"
 
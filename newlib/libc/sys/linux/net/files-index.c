@@ -0,0 +1,770 @@
+/* Indexed lookups in /etc/hosts, /etc/services and /etc/protocols.
+
+   The "files" NSS module parses its text file from the start on every
+   gethostbyname, getservbyname or getprotobyname call.  For the keyed
+   lookups of these three databases libc answers "files" itself: each
+   file is read once into memory, split into entries and indexed by
+   name (and port or protocol number) in a hash table.  The table is
+   kept until the file's inode, size, mtime or ctime changes, which a
+   stat() on each lookup detects, so a lookup neither reopens nor
+   rescans the file.  Enumeration (gethostent etc.) and the other
+   databases still go to the NSS module.
+
+   Answers are the ones the module gives: the first matching line, or
+   with "multi on" in /etc/host.conf the addresses of all matching
+   lines of the hosts file.  */
+
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <resolv.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/stat.h>
+#include <bits/libc-lock.h>
+#include "nss.h"
+#include "res_hconf.h"
+#include "local.h"
+
+/* One line of a database.  */
+struct files_ent
+{
+  char *name;
+  char **aliases;		/* NULL terminated */
+  union
+  {
+    struct
+    {
+      int af;
+      unsigned char addr[16];
+    } host;
+    struct
+    {
+      int port;			/* network byte order */
+      char *proto;
+    } serv;
+    int proto;
+  } u;
+};
+
+/* Hash chain link.  Chains are in file order.  */
+struct files_key
+{
+  struct files_key *next;
+  const char *name;		/* NULL for a number key */
+  unsigned int num;
+  int ent;
+};
+
+struct files_db
+{
+  const char *path;
+  int (*parse) (char *, struct files_ent *, char **);
+  int icase;			/* names compare case-insensitively */
+  /* Identity of the file the index was built from.  */
+  int valid;
+  dev_t dev;
+  ino_t ino;
+  off_t size;
+  time_t mtime, ctime;
+  /* The index.  */
+  char *text;
+  struct files_ent *ents;
+  char **aliasv;
+  struct files_key *keys;
+  struct files_key **names, **nums;
+  unsigned int nbuckets;
+};
+
+static int parse_host (char *, struct files_ent *, char **);
+static int parse_serv (char *, struct files_ent *, char **);
+static int parse_proto (char *, struct files_ent *, char **);
+
+static struct files_db hosts_db =
+  { _PATH_HOSTS, parse_host, 1 };
+static struct files_db services_db =
+  { _PATH_SERVICES, parse_serv, 0 };
+static struct files_db protocols_db =
+  { _PATH_PROTOCOLS, parse_proto, 0 };
+
+/* Guards all three databases.  */
+__libc_lock_define_initialized (static, lock);
+
+static unsigned int
+hash_name (const char *s, int icase)
+{
+  unsigned int h = 5381;
+
+  if (icase)
+    for (; *s != '\0'; s++)
+      h = h * 33 + tolower ((unsigned char) *s);
+  else
+    for (; *s != '\0'; s++)
+      h = h * 33 + (unsigned char) *s;
+  return h;
+}
+
+static int
+name_eq (const struct files_db *db, const char *a, const char *b)
+{
+  return (db->icase ? strcasecmp (a, b) : strcmp (a, b)) == 0;
+}
+
+/* Split LINE into whitespace separated words, stopping at a comment.
+   Returns the number of words stored in WORDS, which must have room
+   for MAX.  Extra words are dropped.  */
+static int
+split_line (char *line, char **words, int max)
+{
+  int n = 0;
+
+  for (;;)
+    {
+      while (*line == ' ' || *line == '\t')
+	++line;
+      if (*line == '\0' || *line == '#')
+	break;
+      if (n < max)
+	words[n++] = line;
+      while (*line != '\0' && *line != ' ' && *line != '\t' && *line != '#')
+	++line;
+      if (*line == '#')
+	{
+	  *line = '\0';
+	  break;
+	}
+      if (*line != '\0')
+	*line++ = '\0';
+    }
+  return n;
+}
+
+/* The parsers return the number of aliases they stored in ALIASV (at
+   most 35), or -1 if the line holds no entry.  */
+#define MAX_WORDS 37
+
+static int
+parse_host (char *line, struct files_ent *ent, char **aliasv)
+{
+  char *w[MAX_WORDS];
+  int n, i;
+
+  n = split_line (line, w, MAX_WORDS);
+  if (n < 2)
+    return -1;
+  if (inet_pton (AF_INET, w[0], ent->u.host.addr) > 0)
+    ent->u.host.af = AF_INET;
+  else if (inet_pton (AF_INET6, w[0], ent->u.host.addr) > 0)
+    ent->u.host.af = AF_INET6;
+  else
+    return -1;
+  ent->name = w[1];
+  for (i = 2; i < n; i++)
+    aliasv[i - 2] = w[i];
+  return n - 2;
+}
+
+static int
+parse_serv (char *line, struct files_ent *ent, char **aliasv)
+{
+  char *w[MAX_WORDS];
+  char *slash, *end;
+  unsigned long port;
+  int n, i;
+
+  n = split_line (line, w, MAX_WORDS);
+  if (n < 2 || (slash = strchr (w[1], '/')) == NULL)
+    return -1;
+  *slash = '\0';
+  port = strtoul (w[1], &end, 10);
+  if (end == w[1] || *end != '\0' || port > 0xffff)
+    return -1;
+  ent->name = w[0];
+  ent->u.serv.port = htons (port);
+  ent->u.serv.proto = slash + 1;
+  for (i = 2; i < n; i++)
+    aliasv[i - 2] = w[i];
+  return n - 2;
+}
+
+static int
+parse_proto (char *line, struct files_ent *ent, char **aliasv)
+{
+  char *w[MAX_WORDS];
+  char *end;
+  long proto;
+  int n, i;
+
+  n = split_line (line, w, MAX_WORDS);
+  if (n < 2)
+    return -1;
+  proto = strtol (w[1], &end, 10);
+  if (end == w[1] || *end != '\0')
+    return -1;
+  ent->name = w[0];
+  ent->u.proto = proto;
+  for (i = 2; i < n; i++)
+    aliasv[i - 2] = w[i];
+  return n - 2;
+}
+
+static void
+free_index (struct files_db *db)
+{
+  free (db->text);
+  free (db->ents);
+  free (db->aliasv);
+  free (db->keys);
+  free (db->names);
+  db->text = NULL;
+  db->ents = NULL;
+  db->aliasv = NULL;
+  db->keys = NULL;
+  db->names = db->nums = NULL;
+  db->valid = 0;
+}
+
+static void
+add_key (struct files_key *k, struct files_key **bucket,
+	 const char *name, unsigned int num, int ent)
+{
+  k->name = name;
+  k->num = num;
+  k->ent = ent;
+  k->next = *bucket;
+  *bucket = k;
+}
+
+/* Read the file named by DB and index it.  Returns 0 on success, -1
+   with errno set if the file cannot be read.  */
+static int
+build_index (struct files_db *db, const struct stat *st)
+{
+  char *text, *line, *next;
+  size_t len, nlines, naliases;
+  struct files_ent *ents;
+  char **aliasv, **av;
+  struct files_key *keys, *k;
+  unsigned int nbuckets, i;
+  int fd, n, nent;
+  ssize_t r;
+
+  free_index (db);
+
+  fd = open (db->path, O_RDONLY);
+  if (fd < 0)
+    return -1;
+  len = st->st_size;
+  text = malloc (len + 1);
+  if (text == NULL)
+    {
+      close (fd);
+      return -1;
+    }
+  for (i = 0; i < len; i += r)
+    {
+      r = read (fd, text + i, len - i);
+      if (r < 0 && errno == EINTR)
+	r = 0;
+      else if (r <= 0)
+	break;
+    }
+  close (fd);
+  len = i;
+  text[len] = '\0';
+
+  /* Upper bounds for the tables: one entry per line, one alias or
+     terminator per word.  */
+  nlines = 1;
+  naliases = 1;
+  for (i = 0; i < len; i++)
+    if (text[i] == '\n')
+      ++nlines;
+    else if (text[i] == ' ' || text[i] == '\t')
+      ++naliases;
+  naliases += nlines;
+
+  ents = malloc (nlines * sizeof *ents);
+  aliasv = malloc (naliases * sizeof *aliasv);
+  if (ents == NULL || aliasv == NULL)
+    goto nomem;
+
+  nent = 0;
+  av = aliasv;
+  for (line = text; line != NULL; line = next)
+    {
+      next = strchr (line, '\n');
+      if (next != NULL)
+	*next++ = '\0';
+      /* A line cannot have more aliases than blanks, so the alias
+	 vector never overflows.  */
+      n = db->parse (line, &ents[nent], av);
+      if (n < 0)
+	continue;
+      ents[nent].aliases = av;
+      av += n;
+      *av++ = NULL;
+      ++nent;
+    }
+
+  /* Every name and alias gets a key, and so does every number.  */
+  nbuckets = 64;
+  while (nbuckets < (unsigned int) nent)
+    nbuckets <<= 1;
+  keys = malloc (((av - aliasv) + 2 * nent + 1) * sizeof *keys);
+  db->names = calloc (2 * nbuckets, sizeof *db->names);
+  if (keys == NULL || db->names == NULL)
+    {
+      free (keys);
+      free (db->names);
+      db->names = NULL;
+      goto nomem;
+    }
+  db->nums = db->names + nbuckets;
+  db->nbuckets = nbuckets;
+
+  /* Insert back to front so that the chains end up in file order.  */
+  k = keys;
+  for (n = nent - 1; n >= 0; n--)
+    {
+      struct files_ent *e = &ents[n];
+      char **a;
+      unsigned int num;
+
+      for (a = e->aliases; *a != NULL; a++)
+	;
+      while (a-- > e->aliases)
+	add_key (k++, &db->names[hash_name (*a, db->icase)
+				     & (nbuckets - 1)], *a, 0, n);
+      add_key (k++, &db->names[hash_name (e->name, db->icase)
+				   & (nbuckets - 1)], e->name, 0, n);
+      /* Hash ports in host order; the low bits of a port in network
+	 order are its high byte, which is zero for most services.  */
+      if (db == &services_db)
+	num = ntohs (e->u.serv.port);
+      else if (db == &protocols_db)
+	num = e->u.proto;
+      else
+	continue;
+      add_key (k++, &db->nums[num & (nbuckets - 1)], NULL, num, n);
+    }
+
+  db->text = text;
+  db->ents = ents;
+  db->aliasv = aliasv;
+  db->keys = keys;
+  db->dev = st->st_dev;
+  db->ino = st->st_ino;
+  db->size = st->st_size;
+  db->mtime = st->st_mtime;
+  db->ctime = st->st_ctime;
+  db->valid = 1;
+  return 0;
+
+ nomem:
+  free (text);
+  free (ents);
+  free (aliasv);
+  __set_errno (ENOMEM);
+  return -1;
+}
+
+/* Lock DB and make sure its index matches the file.  Returns 0 with
+   the lock held, or -1 with errno set and the lock released.  */
+static int
+open_db (struct files_db *db)
+{
+  struct stat st;
+
+  __libc_lock_lock (lock);
+  if (stat (db->path, &st) < 0)
+    {
+      int saved_errno = errno;
+
+      free_index (db);
+      __libc_lock_unlock (lock);
+      __set_errno (saved_errno);
+      return -1;
+    }
+  if (!db->valid
+      || st.st_dev != db->dev || st.st_ino != db->ino
+      || st.st_size != db->size
+      || st.st_mtime != db->mtime || st.st_ctime != db->ctime)
+    if (build_index (db, &st) < 0)
+      {
+	int saved_errno = errno;
+
+	__libc_lock_unlock (lock);
+	__set_errno (saved_errno);
+	return -1;
+      }
+  return 0;
+}
+
+/* Space needed to copy NAME and the aliases of E, and the number of
+   aliases.  */
+static size_t
+strings_size (const char *name, const struct files_ent *e, int *naliases)
+{
+  size_t size = strlen (name) + 1;
+  char **a;
+
+  for (a = e->aliases; *a != NULL; a++)
+    size += strlen (*a) + 1;
+  *naliases = a - e->aliases;
+  return size;
+}
+
+/* Copy the aliases of E into BUFFER behind the pointer vector ALIASES.  */
+static char *
+copy_aliases (const struct files_ent *e, char **aliases, char *p)
+{
+  char **a;
+
+  for (a = e->aliases; *a != NULL; a++)
+    {
+      *aliases++ = p;
+      p = stpcpy (p, *a) + 1;
+    }
+  *aliases = NULL;
+  return p;
+}
+
+/* Align BUFFER for a pointer vector; returns NULL if BUFLEN is too
+   small for NEED bytes after that.  */
+static char *
+align_buffer (char *buffer, size_t buflen, size_t need)
+{
+  size_t pad = -(uintptr_t) buffer & (__alignof__ (char *) - 1);
+
+  if (buflen < pad || buflen - pad < need)
+    return NULL;
+  return buffer + pad;
+}
+
+static enum nss_status
+files_gethostbyname3_r (const char *name, int af, struct hostent *result,
+			char *buffer, size_t buflen, int *errnop,
+			int *herrnop, int32_t *ttlp, char **canonp)
+{
+  struct files_db *db = &hosts_db;
+  struct files_key *k;
+  const struct files_ent *first = NULL;
+  size_t addrlen, need;
+  int naddrs = 0, naliases, map, multi, last, i;
+  char **addrv, *p;
+
+  if (af != AF_INET && af != AF_INET6)
+    {
+      *errnop = EAFNOSUPPORT;
+      *herrnop = NO_DATA;
+      return NSS_STATUS_UNAVAIL;
+    }
+  /* Like the module: with RES_USE_INET6, IPv4 lines answer AF_INET6
+     queries as mapped addresses.  */
+  map = af == AF_INET6 && (_res.options & RES_USE_INET6);
+  addrlen = af == AF_INET6 ? 16 : 4;
+  if (!_res_hconf.initialized)
+    _res_hconf_init ();
+  multi = (_res_hconf.flags & HCONF_FLAG_MULTI) != 0;
+
+  if (open_db (db) < 0)
+    {
+      *errnop = errno;
+      *herrnop = NO_RECOVERY;
+      return errno == EAGAIN ? NSS_STATUS_TRYAGAIN : NSS_STATUS_UNAVAIL;
+    }
+
+  /* Count the matching lines first.  A line that matches by more
+     than one of its names is counted once; chains are in file order,
+     so such keys follow each other.  */
+  last = -1;
+  for (k = db->names[hash_name (name, 1) & (db->nbuckets - 1)];
+       k != NULL; k = k->next)
+    {
+      const struct files_ent *e = &db->ents[k->ent];
+
+      if ((e->u.host.af != af && !(map && e->u.host.af == AF_INET))
+	  || !name_eq (db, k->name, name))
+	continue;
+      if (k->ent == last)
+	continue;
+      last = k->ent;
+      if (first == NULL)
+	first = e;
+      ++naddrs;
+      if (!multi)
+	break;
+    }
+  if (first == NULL)
+    {
+      __libc_lock_unlock (lock);
+      *errnop = ENOENT;
+      *herrnop = HOST_NOT_FOUND;
+      return NSS_STATUS_NOTFOUND;
+    }
+
+  need = strings_size (first->name, first, &naliases);
+  need += (naddrs + naliases + 2) * sizeof (char *) + naddrs * addrlen;
+  buffer = align_buffer (buffer, buflen, need);
+  if (buffer == NULL)
+    {
+      __libc_lock_unlock (lock);
+      *errnop = ERANGE;
+      *herrnop = NETDB_INTERNAL;
+      return NSS_STATUS_TRYAGAIN;
+    }
+
+  addrv = (char **) buffer;
+  result->h_aliases = addrv + naddrs + 1;
+  p = (char *) (result->h_aliases + naliases + 1);
+  i = 0;
+  last = -1;
+  for (k = db->names[hash_name (name, 1) & (db->nbuckets - 1)];
+       k != NULL && i < naddrs; k = k->next)
+    {
+      const struct files_ent *e = &db->ents[k->ent];
+
+      if ((e->u.host.af != af && !(map && e->u.host.af == AF_INET))
+	  || !name_eq (db, k->name, name))
+	continue;
+      if (k->ent == last)
+	continue;
+      last = k->ent;
+      addrv[i++] = p;
+      if (e->u.host.af == af)
+	memcpy (p, e->u.host.addr, addrlen);
+      else
+	{
+	  memset (p, 0, 10);
+	  memset (p + 10, 0xff, 2);
+	  memcpy (p + 12, e->u.host.addr, 4);
+	}
+      p += addrlen;
+    }
+  addrv[i] = NULL;
+  result->h_addr_list = addrv;
+  result->h_addrtype = af;
+  result->h_length = addrlen;
+  result->h_name = p;
+  p = stpcpy (p, first->name) + 1;
+  copy_aliases (first, result->h_aliases, p);
+  __libc_lock_unlock (lock);
+
+  if (canonp != NULL)
+    *canonp = result->h_name;
+  return NSS_STATUS_SUCCESS;
+}
+
+static enum nss_status
+files_gethostbyname2_r (const char *name, int af, struct hostent *result,
+			char *buffer, size_t buflen, int *errnop,
+			int *herrnop)
+{
+  return files_gethostbyname3_r (name, af, result, buffer, buflen, errnop,
+				 herrnop, NULL, NULL);
+}
+
+static enum nss_status
+files_gethostbyname_r (const char *name, struct hostent *result,
+		       char *buffer, size_t buflen, int *errnop,
+		       int *herrnop)
+{
+  return files_gethostbyname3_r (name,
+				 (_res.options & RES_USE_INET6)
+				 ? AF_INET6 : AF_INET,
+				 result, buffer, buflen, errnop, herrnop,
+				 NULL, NULL);
+}
+
+/* Copy entry E of services_db or protocols_db into the caller's
+   buffer.  Returns the start of the alias vector or NULL if BUFFER is
+   too small.  */
+static char **
+copy_entry (const struct files_ent *e, const char *proto, char *buffer,
+	    size_t buflen, char **namep, char **protop)
+{
+  size_t need;
+  int naliases;
+  char **aliases, *p;
+
+  need = strings_size (e->name, e, &naliases);
+  need += (naliases + 1) * sizeof (char *);
+  if (proto != NULL)
+    need += strlen (proto) + 1;
+  buffer = align_buffer (buffer, buflen, need);
+  if (buffer == NULL)
+    return NULL;
+  aliases = (char **) buffer;
+  p = (char *) (aliases + naliases + 1);
+  *namep = p;
+  p = stpcpy (p, e->name) + 1;
+  if (proto != NULL)
+    {
+      *protop = p;
+      p = stpcpy (p, proto) + 1;
+    }
+  copy_aliases (e, aliases, p);
+  return aliases;
+}
+
+static enum nss_status
+finish_lookup (struct files_db *db, const struct files_ent *e,
+	       char **aliases, int *errnop)
+{
+  __libc_lock_unlock (lock);
+  if (e == NULL)
+    {
+      *errnop = ENOENT;
+      return NSS_STATUS_NOTFOUND;
+    }
+  if (aliases == NULL)
+    {
+      *errnop = ERANGE;
+      return NSS_STATUS_TRYAGAIN;
+    }
+  return NSS_STATUS_SUCCESS;
+}
+
+static enum nss_status
+db_unavailable (int *errnop)
+{
+  *errnop = errno;
+  return errno == EAGAIN ? NSS_STATUS_TRYAGAIN : NSS_STATUS_UNAVAIL;
+}
+
+static enum nss_status
+files_getservbyname_r (const char *name, const char *proto,
+		       struct servent *result, char *buffer, size_t buflen,
+		       int *errnop)
+{
+  struct files_db *db = &services_db;
+  const struct files_ent *e = NULL;
+  struct files_key *k;
+  char **aliases = NULL;
+
+  if (open_db (db) < 0)
+    return db_unavailable (errnop);
+  for (k = db->names[hash_name (name, 0) & (db->nbuckets - 1)];
+       k != NULL; k = k->next)
+    if (strcmp (k->name, name) == 0
+	&& (proto == NULL
+	    || strcmp (db->ents[k->ent].u.serv.proto, proto) == 0))
+      {
+	e = &db->ents[k->ent];
+	aliases = copy_entry (e, e->u.serv.proto, buffer, buflen,
+			      &result->s_name, &result->s_proto);
+	result->s_aliases = aliases;
+	result->s_port = e->u.serv.port;
+	break;
+      }
+  return finish_lookup (db, e, aliases, errnop);
+}
+
+static enum nss_status
+files_getservbyport_r (int port, const char *proto, struct servent *result,
+		       char *buffer, size_t buflen, int *errnop)
+{
+  struct files_db *db = &services_db;
+  const struct files_ent *e = NULL;
+  struct files_key *k;
+  char **aliases = NULL;
+
+  if (open_db (db) < 0)
+    return db_unavailable (errnop);
+  for (k = db->nums[ntohs (port) & (db->nbuckets - 1)];
+       k != NULL; k = k->next)
+    if (db->ents[k->ent].u.serv.port == port
+	&& (proto == NULL
+	    || strcmp (db->ents[k->ent].u.serv.proto, proto) == 0))
+      {
+	e = &db->ents[k->ent];
+	aliases = copy_entry (e, e->u.serv.proto, buffer, buflen,
+			      &result->s_name, &result->s_proto);
+	result->s_aliases = aliases;
+	result->s_port = e->u.serv.port;
+	break;
+      }
+  return finish_lookup (db, e, aliases, errnop);
+}
+
+static enum nss_status
+files_getprotobyname_r (const char *name, struct protoent *result,
+			char *buffer, size_t buflen, int *errnop)
+{
+  struct files_db *db = &protocols_db;
+  const struct files_ent *e = NULL;
+  struct files_key *k;
+  char **aliases = NULL;
+
+  if (open_db (db) < 0)
+    return db_unavailable (errnop);
+  for (k = db->names[hash_name (name, 0) & (db->nbuckets - 1)];
+       k != NULL; k = k->next)
+    if (strcmp (k->name, name) == 0)
+      {
+	e = &db->ents[k->ent];
+	aliases = copy_entry (e, NULL, buffer, buflen, &result->p_name, NULL);
+	result->p_aliases = aliases;
+	result->p_proto = e->u.proto;
+	break;
+      }
+  return finish_lookup (db, e, aliases, errnop);
+}
+
+static enum nss_status
+files_getprotobynumber_r (int proto, struct protoent *result, char *buffer,
+			  size_t buflen, int *errnop)
+{
+  struct files_db *db = &protocols_db;
+  const struct files_ent *e = NULL;
+  struct files_key *k;
+  char **aliases = NULL;
+
+  if (open_db (db) < 0)
+    return db_unavailable (errnop);
+  for (k = db->nums[(unsigned int) proto & (db->nbuckets - 1)];
+       k != NULL; k = k->next)
+    if (db->ents[k->ent].u.proto == proto)
+      {
+	e = &db->ents[k->ent];
+	aliases = copy_entry (e, NULL, buffer, buflen, &result->p_name, NULL);
+	result->p_aliases = aliases;
+	result->p_proto = e->u.proto;
+	break;
+      }
+  return finish_lookup (db, e, aliases, errnop);
+}
+
+/* The functions libc provides for SERVICE itself, or NULL.  */
+void *
+__nss_files_index_function (const char *service, const char *fct_name)
+{
+  static const struct
+  {
+    const char *name;
+    void *fct;
+  } tbl[] =
+    {
+      { "gethostbyname_r", files_gethostbyname_r },
+      { "gethostbyname2_r", files_gethostbyname2_r },
+      { "gethostbyname3_r", files_gethostbyname3_r },
+      { "getservbyname_r", files_getservbyname_r },
+      { "getservbyport_r", files_getservbyport_r },
+      { "getprotobyname_r", files_getprotobyname_r },
+      { "getprotobynumber_r", files_getprotobynumber_r }
+    };
+  size_t i;
+
+  if (strcmp (service, "files") != 0)
+    return NULL;
+  for (i = 0; i < sizeof tbl / sizeof tbl[0]; i++)
+    if (strcmp (tbl[i].name, fct_name) == 0)
+      return tbl[i].fct;
+  return NULL;
+}
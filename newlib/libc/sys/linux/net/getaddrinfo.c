@@ -312,6 +312,8 @@ gaih_inet_serv (const char *servicename, const struct gaih_typeproto *tp,
       if (herrno == NETDB_INTERNAL)					      \
 	{								      \
 	  h_errno = (herrno);					      \
+	  _res.options = old_res_options;				      \
+	  _res._flags &= ~RES_F_CACHE;					      \
 	  return -EAI_SYSTEM;						      \
 	}								      \
       if (herrno == TRY_AGAIN)						      \
@@ -822,6 +824,9 @@ gaih_inet (const char *name, const struct gaih_service *service,
 	     by setting the RES_USE_INET6 bit in _res.options.  */
 	  old_res_options = _res.options;
 	  _res.options &= ~RES_USE_INET6;
+	  /* The NSS hosts backends may answer from the resolver's cache
+	     (see res_query.c), but only on behalf of getaddrinfo.  */
+	  _res._flags |= RES_F_CACHE;
 
 	  size_t tmpbuflen = 512;
 	  char *tmpbuf = alloca (tmpbuflen);
@@ -844,6 +849,14 @@ gaih_inet (const char *name, const struct gaih_service *service,
 
 	      if (fct != NULL)
 		{
+		  /* Ask for both address types at once; the AAAA and A
+		     lookups below are then answered from the resolver's
+		     cache.  */
+		  if (req->ai_family == AF_UNSPEC
+		      && (_res.options & RES_INIT) != 0
+		      && strcmp (nip->name, "dns") == 0)
+		    __res_nprefetch2 (&_res, name, C_IN, T_AAAA, T_A);
+
 		  if (req->ai_family == AF_INET6
 		      || req->ai_family == AF_UNSPEC)
 		    {
@@ -921,6 +934,7 @@ gaih_inet (const char *name, const struct gaih_service *service,
 	    }
 
 	  _res.options = old_res_options;
+	  _res._flags &= ~RES_F_CACHE;
 
 	  if (no_data != 0 && no_inet6_data != 0)
 	    {
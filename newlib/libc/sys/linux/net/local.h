@@ -22,3 +22,48 @@
 extern const char *_res_opcodes[];
 libresolv_hidden_proto (_res_opcodes)
 
+/* files-index.c */
+extern void *__nss_files_index_function (const char *, const char *);
+
+#ifdef _ARPA_NAMESER_H_
+/* ns_parse.c: records of a message with their names left compressed. */
+struct __ns_rrit {
+	const u_char	*_eom, *_ptr;
+	u_int16_t	_counts[ns_s_max];
+	int		_sect, _rrnum;
+};
+struct __ns_wrr {
+	ns_sect		section;
+	const u_char	*name;
+	u_int16_t	type;
+	u_int16_t	rr_class;
+	u_int32_t	ttl;
+	u_int16_t	rdlength;
+	const u_char	*rdata;
+};
+extern int __ns_rrit_init (struct __ns_rrit *, const u_char *, int);
+extern int __ns_rrit_next (struct __ns_rrit *, struct __ns_wrr *);
+
+/* ns_name.c: compare compressed names with one name, without expanding. */
+#define NS_NAMECMP_CACHE 8
+struct __ns_namecmp {
+	const u_char	*_msg, *_eom;
+	u_char		_name[NS_MAXCDNAME];	/* lower case */
+	struct {
+		int	off, pos, result;
+	}		_cache[NS_NAMECMP_CACHE];
+	int		_ncache, _next;
+};
+extern int __ns_namecmp_init (struct __ns_namecmp *, const u_char *,
+			      const u_char *, const u_char *);
+extern int __ns_namecmp (struct __ns_namecmp *, const u_char *);
+#endif
+
+#ifdef _RESOLV_H_
+/* res_send.c, res_query.c */
+extern int __libc_res_nsend2 (res_state, const u_char *, int,
+			      const u_char *, int, u_char *, int, int *,
+			      u_char *, int, int *);
+extern void __res_nprefetch2 (res_state, const char *, int, int, int);
+#endif
+
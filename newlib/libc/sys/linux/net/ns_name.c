@@ -30,6 +30,7 @@ static const char rcsid[] = "$BINDId: ns_name.c,v 8.15 2000/03/30 22:53:46 vixie
 #include <string.h>
 #include <ctype.h>
 #include "libc-symbols.h"
+#include "local.h"
 
 /* Data. */
 
@@ -39,6 +40,7 @@ static const char	digits[] = "0123456789";
 
 static int		special(int);
 static int		printable(int);
+static int		mklower(int);
 static int		dn_find(const u_char *, const u_char *,
 				const u_char * const *,
 				const u_char * const *);
@@ -633,6 +635,127 @@ ns_name_skip(const u_char **ptrptr, const u_char *eom) {
 	return (0);
 }
 
+/*
+ * __ns_namecmp_init(nc, msg, eom, name)
+ *	Prepare to compare names in (msg, eom) against NAME, which must be
+ *	uncompressed.
+ * return:
+ *	0 on success, -1 (with errno set) if NAME is not a valid name.
+ */
+int
+__ns_namecmp_init(struct __ns_namecmp *nc, const u_char *msg,
+		  const u_char *eom, const u_char *name)
+{
+	u_char *dstp = nc->_name;
+	u_int n;
+
+	while ((n = *name++) != 0) {
+		if ((n & NS_CMPRSFLGS) != 0 ||
+		    dstp + n + 1 >= nc->_name + sizeof nc->_name) {
+			__set_errno (EMSGSIZE);
+			return (-1);
+		}
+		*dstp++ = n;
+		for ((void)NULL; n > 0; n--)
+			*dstp++ = mklower(*name++);
+	}
+	*dstp = 0;
+	nc->_msg = msg;
+	nc->_eom = eom;
+	nc->_ncache = 0;
+	nc->_next = 0;
+	return (0);
+}
+
+/*
+ * __ns_namecmp(nc, src)
+ *	Compare the possibly compressed name at SRC with the name NC was
+ *	set up with, ignoring case.  Labels are compared in place, so the
+ *	name is never expanded, and the comparison stops at the first
+ *	difference.  The names in a reply mostly end in pointers to a few
+ *	earlier names, so the outcome of following the first pointer from
+ *	a given position in the target is remembered in a small cache.
+ *	Extended label types are treated as format errors.
+ * return:
+ *	1 if the names are the same, 0 if not, -1 (with errno set) if
+ *	SRC is malformed.
+ */
+int
+__ns_namecmp(struct __ns_namecmp *nc, const u_char *src) {
+	const u_char *msg = nc->_msg, *eom = nc->_eom;
+	const u_char *np = nc->_name;
+	int off = -1, pos = 0, checked = 0, result, i;
+	u_int n;
+
+	for (;;) {
+		if (src < msg || src >= eom) {
+			__set_errno (EMSGSIZE);
+			return (-1);
+		}
+		n = *src++;
+		switch (n & NS_CMPRSFLGS) {
+		case 0:
+			if (n != *np) {
+				result = 0;
+				goto done;
+			}
+			if (n == 0) {
+				result = 1;
+				goto done;
+			}
+			if (src + n >= eom) {
+				__set_errno (EMSGSIZE);
+				return (-1);
+			}
+			checked += n + 1;
+			for (np++; n > 0; n--)
+				if (mklower(*src++) != *np++) {
+					result = 0;
+					goto done;
+				}
+			break;
+
+		case NS_CMPRSFLGS:
+			if (src >= eom) {
+				__set_errno (EMSGSIZE);
+				return (-1);
+			}
+			n = ((n & 0x3f) << 8) | *src;
+			if (off < 0) {
+				off = n;
+				pos = np - nc->_name;
+				for (i = 0; i < nc->_ncache; i++)
+					if (nc->_cache[i].off == off &&
+					    nc->_cache[i].pos == pos)
+						return (nc->_cache[i].result);
+			}
+			src = msg + n;
+			/* A loop, if we've looked at the whole message. */
+			checked += 2;
+			if (checked >= eom - msg) {
+				__set_errno (EMSGSIZE);
+				return (-1);
+			}
+			break;
+
+		default:
+			__set_errno (EMSGSIZE);
+			return (-1);
+		}
+	}
+ done:
+	if (off >= 0) {
+		i = nc->_next;
+		nc->_next = (i + 1) % NS_NAMECMP_CACHE;
+		if (nc->_ncache < NS_NAMECMP_CACHE)
+			nc->_ncache++;
+		nc->_cache[i].off = off;
+		nc->_cache[i].pos = pos;
+		nc->_cache[i].result = result;
+	}
+	return (result);
+}
+
 /* Private. */
 
 /*
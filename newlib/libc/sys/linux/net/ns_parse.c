@@ -31,6 +31,7 @@ static const char rcsid[] = "$BINDId: ns_parse.c,v 8.13 1999/10/13 16:39:35 vixi
 #include <string.h>
 
 #include "libc-symbols.h"
+#include "local.h"
 
 /* Forward. */
 
@@ -181,6 +182,75 @@ ns_parserr(ns_msg *handle, ns_sect section, int rrnum, ns_rr *rr) {
 	return (0);
 }
 
+/*
+ * Walk all records of a message in one pass.  Unlike ns_parserr(),
+ * which expands every owner name into the caller's ns_rr, the names
+ * are left in the message for ns_name_unpack() or __ns_namecmp().
+ */
+int
+__ns_rrit_init(struct __ns_rrit *it, const u_char *msg, int msglen) {
+	int i;
+
+	if (msglen < NS_HFIXEDSZ)
+		RETERR(EMSGSIZE);
+	it->_eom = msg + msglen;
+	msg += 2 * NS_INT16SZ;		/* ID, flags. */
+	for (i = 0; i < ns_s_max; i++)
+		NS_GET16(it->_counts[i], msg);
+	it->_ptr = msg;
+	it->_sect = ns_s_qd;
+	it->_rrnum = 0;
+	return (0);
+}
+
+/*
+ * __ns_rrit_next(it, rr)
+ *	Fetch the next record.
+ * return:
+ *	1 with the record in RR, 0 at the end of the message, or -1 (with
+ *	errno set) if the records do not end exactly at the end of the
+ *	message, as in ns_initparse().
+ */
+int
+__ns_rrit_next(struct __ns_rrit *it, struct __ns_wrr *rr) {
+	const u_char *ptr = it->_ptr;
+
+	while (it->_rrnum >= it->_counts[it->_sect]) {
+		if (it->_sect == ns_s_max - 1) {
+			if (ptr != it->_eom)
+				RETERR(EMSGSIZE);
+			return (0);
+		}
+		it->_sect++;
+		it->_rrnum = 0;
+	}
+	rr->section = (ns_sect)it->_sect;
+	rr->name = ptr;
+	if (ns_name_skip(&ptr, it->_eom) < 0)
+		return (-1);
+	if (ptr + NS_INT16SZ + NS_INT16SZ > it->_eom)
+		RETERR(EMSGSIZE);
+	NS_GET16(rr->type, ptr);
+	NS_GET16(rr->rr_class, ptr);
+	if (it->_sect == ns_s_qd) {
+		rr->ttl = 0;
+		rr->rdlength = 0;
+		rr->rdata = NULL;
+	} else {
+		if (ptr + NS_INT32SZ + NS_INT16SZ > it->_eom)
+			RETERR(EMSGSIZE);
+		NS_GET32(rr->ttl, ptr);
+		NS_GET16(rr->rdlength, ptr);
+		if (ptr + rr->rdlength > it->_eom)
+			RETERR(EMSGSIZE);
+		rr->rdata = ptr;
+		ptr += rr->rdlength;
+	}
+	it->_ptr = ptr;
+	it->_rrnum++;
+	return (1);
+}
+
 /* Private. */
 
 static void
@@ -330,6 +330,12 @@ __nss_lookup_function (service_user *ni, const char *fct_name)
 		}
 	    }
 
+	  /* Libc answers the keyed lookups of the files service for
+	     hosts, services and protocols from an index of its own.  */
+	  result = __nss_files_index_function (ni->name, fct_name);
+	  if (result != NULL)
+	    goto remember;
+
 #if !defined DO_STATIC_NSS || defined SHARED
 	  if (ni->library->lib_handle == NULL)
 	    {
@@ -411,6 +417,7 @@ __nss_lookup_function (service_user *ni, const char *fct_name)
 
 	  /* Remember function pointer for later calls.  Even if null, we
 	     record it so a second try needn't search the library again.  */
+	remember:
 	  known->fct_ptr = result;
 	}
     }
@@ -81,7 +81,10 @@ static const char rcsid[] = "$BINDId: res_query.c,v 8.20 2000/02/29 05:39:12 vix
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#include <bits/libc-lock.h>
 #include "libc-symbols.h"
+#include "local.h"
 
 /* Options.  Leave them on. */
 /* #undef DEBUG */
@@ -99,6 +102,211 @@ __libc_res_nquerydomain(res_state statp, const char *name, const char *domain,
 			int class, int type, u_char *answer, int anslen,
 			u_char **answerp);
 
+/*
+ * Answer cache for the lookups getaddrinfo makes through the NSS hosts
+ * backends.  It is only used while getaddrinfo has RES_F_CACHE set in
+ * _res._flags; res_query and friends called by anyone else always go
+ * to the network.  Entries are keyed by name, class and type and by the
+ * name servers and query options of the resolver state they came from.
+ * Both positive answers and negative ones (NXDOMAIN and NODATA with an
+ * SOA, RFC 2308) are kept for their TTL, but never longer than
+ * RES_CACHE_MAXTTL seconds.  The table is direct mapped: a new answer
+ * simply replaces whatever occupied its slot.  Queries made with hooks
+ * or by debugging tools (pfcode set) are never cached.
+ */
+#define RES_CACHE_SIZE		64
+#define RES_CACHE_MAXTTL	300
+
+struct res_cache_ent {
+	u_char *answer;		/* response, followed by the name */
+	int anslen;
+	int class, type;
+	u_int32_t ctx;		/* res_cache_ctx() of the state */
+	time_t expires;
+};
+
+static struct res_cache_ent res_cache[RES_CACHE_SIZE];
+__libc_lock_define_initialized (static, res_cache_lock);
+
+static time_t
+res_cache_now(void)
+{
+	struct timespec ts;
+
+	if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0)
+		return (ts.tv_sec);
+	return (time(NULL));
+}
+
+/*
+ * Hash of what, besides the question, decides the answer: the name
+ * servers asked and the options that go into the query.
+ */
+#define RES_CACHE_OPTIONS	(RES_RECURSE | RES_AAONLY | RES_PRIMARY)
+
+static u_int32_t
+res_cache_mix(u_int32_t h, const void *p, size_t n)
+{
+	const u_char *cp = p;
+
+	while (n-- > 0)
+		h = (h ^ *cp++) * 16777619U;
+	return (h);
+}
+
+static u_int32_t
+res_cache_ctx(res_state statp)
+{
+	u_int32_t h = statp->options & RES_CACHE_OPTIONS;
+	const struct sockaddr_in6 *sin6;
+	int ns;
+
+	for (ns = 0; ns < statp->nscount && ns < MAXNS; ns++) {
+		h = res_cache_mix(h, &statp->nsaddr_list[ns].sin_port,
+				  sizeof (in_port_t));
+		h = res_cache_mix(h, &statp->nsaddr_list[ns].sin_addr,
+				  sizeof (struct in_addr));
+	}
+	/* IPv6 servers from resolv.conf, which res_init marks MAXNS + 1. */
+	for (ns = 0; ns < MAXNS; ns++) {
+		sin6 = statp->_u._ext.nsaddrs[ns];
+		if (statp->_u._ext.nsmap[ns] == MAXNS + 1 && sin6 != NULL) {
+			h = res_cache_mix(h, &sin6->sin6_port,
+					  sizeof (in_port_t));
+			h = res_cache_mix(h, &sin6->sin6_addr,
+					  sizeof (struct in6_addr));
+		}
+	}
+	return (h);
+}
+
+static unsigned int
+res_cache_slot(const char *name, int class, int type, u_int32_t ctx)
+{
+	unsigned int h = ((ctx ^ (ctx >> 16)) * 31 + class) * 31 + type;
+
+	for (; *name != '\0'; name++)
+		h = h * 33 + tolower((unsigned char) *name);
+	return (h % RES_CACHE_SIZE);
+}
+
+static int
+res_cacheable(res_state statp)
+{
+	return ((statp->_flags & RES_F_CACHE) && !statp->qhook
+		&& !statp->rhook && !statp->pfcode
+		&& !(statp->options & RES_DEBUG));
+}
+
+/*
+ * Seconds ANSWER may be reused for, 0 if it must not be cached.
+ */
+static u_int32_t
+res_cache_ttl(const u_char *answer, int anslen)
+{
+	struct __ns_rrit it;
+	struct __ns_wrr rr;
+	u_int32_t ttl = RES_CACHE_MAXTTL, soattl = 0;
+	int n, rcode, positive, soa = 0;
+
+	if (__ns_rrit_init(&it, answer, anslen) < 0)
+		return (0);
+	rcode = ((const HEADER *) answer)->rcode;
+	positive = rcode == ns_r_noerror && it._counts[ns_s_an] > 0;
+	if (!positive && rcode != ns_r_noerror && rcode != ns_r_nxdomain)
+		return (0);
+	/*
+	 * Positive answer: the smallest answer TTL.  Negative answer:
+	 * min(SOA TTL, SOA MINIMUM) of the first SOA in the authority.
+	 */
+	while ((n = __ns_rrit_next(&it, &rr)) > 0) {
+		if (positive && rr.section == ns_s_an) {
+			if (rr.ttl < ttl)
+				ttl = rr.ttl;
+		} else if (!positive && !soa
+			   && rr.section == ns_s_ns
+			   && rr.type == ns_t_soa && rr.rdlength >= 20) {
+			u_int32_t minimum = ns_get32(rr.rdata
+						     + rr.rdlength - 4);
+
+			if (rr.ttl < ttl)
+				ttl = rr.ttl;
+			soattl = minimum < ttl ? minimum : ttl;
+			soa = 1;
+		}
+	}
+	/* Like ns_initparse(), refuse a message that does not parse. */
+	if (n < 0)
+		return (0);
+	return (positive ? ttl : soattl);
+}
+
+/*
+ * Copy a live cached answer for NAME into ANSWER.  Returns its length,
+ * 0 if there is none or it does not fit, and -1 if the last attempt
+ * timed out (see __res_nprefetch2).  A timeout is reported only once.
+ */
+static int
+res_cache_lookup(res_state statp, const char *name, int class, int type,
+		 u_char *answer, int anslen)
+{
+	struct res_cache_ent *ent;
+	u_int32_t ctx = res_cache_ctx(statp);
+	int n = 0;
+
+	ent = &res_cache[res_cache_slot(name, class, type, ctx)];
+	__libc_lock_lock (res_cache_lock);
+	if (ent->answer != NULL && ent->class == class && ent->type == type
+	    && ent->ctx == ctx
+	    && strcasecmp((char *) ent->answer + ent->anslen, name) == 0) {
+		if (ent->anslen == 0 || ent->expires <= res_cache_now()) {
+			if (ent->anslen == 0 && ent->expires > res_cache_now())
+				n = -1;
+			free(ent->answer);
+			ent->answer = NULL;
+		} else if (ent->anslen <= anslen) {
+			memcpy(answer, ent->answer, ent->anslen);
+			n = ent->anslen;
+		}
+	}
+	__libc_lock_unlock (res_cache_lock);
+	return (n);
+}
+
+/*
+ * Keep ANSWER for TTL seconds.  An empty ANSWER records a timeout.
+ */
+static void
+res_cache_store(res_state statp, const char *name, int class, int type,
+		const u_char *answer, int anslen, u_int32_t ttl)
+{
+	struct res_cache_ent *ent;
+	u_int32_t ctx = res_cache_ctx(statp);
+	size_t namelen;
+	u_char *copy;
+
+	if (ttl == 0)
+		return;
+	namelen = strlen(name) + 1;
+	copy = malloc(anslen + namelen);
+	if (copy == NULL)
+		return;
+	if (anslen > 0)
+		memcpy(copy, answer, anslen);
+	memcpy(copy + anslen, name, namelen);
+
+	ent = &res_cache[res_cache_slot(name, class, type, ctx)];
+	__libc_lock_lock (res_cache_lock);
+	free(ent->answer);
+	ent->answer = copy;
+	ent->anslen = anslen;
+	ent->class = class;
+	ent->type = type;
+	ent->ctx = ctx;
+	ent->expires = res_cache_now() + ttl;
+	__libc_lock_unlock (res_cache_lock);
+}
+
 /*
  * Formulate a normal query, send, and await answer.
  * Returned answer is placed in supplied buffer "answer".
@@ -120,9 +328,21 @@ __libc_res_nquery(res_state statp,
 	u_char *buf;
 	HEADER *hp = (HEADER *) answer;
 	int n, use_malloc = 0;
+	int cacheable = res_cacheable(statp);
 
 	hp->rcode = NOERROR;	/* default */
 
+	if (cacheable) {
+		n = res_cache_lookup(statp, name, class, type, answer, anslen);
+		if (n > 0)
+			goto answered;
+		if (n < 0) {
+			__set_errno (ETIMEDOUT);
+			RES_SET_H_ERRNO(statp, TRY_AGAIN);
+			return (-1);
+		}
+	}
+
 	buf = alloca (QUERYSIZE);
 
 #ifdef DEBUG
@@ -163,7 +383,19 @@ __libc_res_nquery(res_state statp,
 		RES_SET_H_ERRNO(statp, TRY_AGAIN);
 		return (n);
 	}
+	if (cacheable) {
+		u_char *ans = answer;
 
+		if (answerp != NULL && *answerp != NULL && *answerp != answer) {
+			ans = *answerp;
+			anslen = MAXPACKET;
+		}
+		if (n <= anslen)
+			res_cache_store(statp, name, class, type, ans, n,
+					res_cache_ttl(ans, n));
+	}
+
+ answered:
 	if (hp->rcode != NOERROR || ntohs(hp->ancount) == 0) {
 #ifdef DEBUG
 		if (statp->options & RES_DEBUG)
@@ -205,6 +437,92 @@ res_nquery(res_state statp,
 }
 libresolv_hidden_def (res_nquery)
 
+/*
+ * Fetch the TYPE1 and TYPE2 records of NAME in one round trip and leave
+ * them in the answer cache, where the res_nsearch calls that follow
+ * (one per type from the NSS hosts backend) will find them.  Only the
+ * first name __libc_res_nsearch would query is fetched; if that one does
+ * not resolve, the rest of the search goes out one query at a time.
+ */
+void
+__res_nprefetch2(res_state statp, const char *name, int class,
+		 int type1, int type2)
+{
+	char nbuf[MAXDNAME], tmp[NS_MAXDNAME];
+	const char *cp;
+	u_char *buf1, *buf2, *ans1, *ans2;
+	int len1, len2, n1, n2, saved_errno, saved_herrno;
+	u_int dots;
+
+	if (!res_cacheable(statp))
+		return;
+
+	/* The first step of __libc_res_nsearch, and __libc_res_nquerydomain. */
+	dots = 0;
+	for (cp = name; *cp != '\0'; cp++)
+		dots += (*cp == '.');
+	len1 = cp - name;
+	if (len1 == 0 || len1 >= MAXDNAME)
+		return;
+	if (cp[-1] == '.') {
+		memcpy(nbuf, name, len1 - 1);
+		nbuf[len1 - 1] = '\0';
+	} else if (!dots
+		   && (cp = res_hostalias(statp, name, tmp, sizeof tmp)) != NULL) {
+		if (strlen(cp) >= MAXDNAME)
+			return;
+		strcpy(nbuf, cp);
+	} else if (dots >= statp->ndots)
+		strcpy(nbuf, name);
+	else if (statp->dnsrch[0] != NULL
+		 && (statp->options & (dots ? RES_DNSRCH : RES_DEFNAMES))) {
+		if (len1 + strlen(statp->dnsrch[0]) + 1 >= MAXDNAME)
+			return;
+		sprintf(nbuf, "%s.%s", name, statp->dnsrch[0]);
+	} else
+		return;
+
+	ans1 = alloca (2 * PACKETSZ);
+	ans2 = alloca (2 * PACKETSZ);
+	if (res_cache_lookup(statp, nbuf, class, type1,
+			     ans1, 2 * PACKETSZ) > 0
+	    && res_cache_lookup(statp, nbuf, class, type2,
+				ans2, 2 * PACKETSZ) > 0)
+		return;
+
+	saved_errno = errno;
+	saved_herrno = statp->res_h_errno;
+	buf1 = alloca (QUERYSIZE);
+	buf2 = alloca (QUERYSIZE);
+	len1 = res_nmkquery(statp, QUERY, nbuf, class, type1, NULL, 0, NULL,
+			    buf1, QUERYSIZE);
+	len2 = res_nmkquery(statp, QUERY, nbuf, class, type2, NULL, 0, NULL,
+			    buf2, QUERYSIZE);
+	if (len1 > 0 && len2 > 0) {
+		switch (__libc_res_nsend2(statp, buf1, len1, buf2, len2,
+					  ans1, 2 * PACKETSZ, &n1,
+					  ans2, 2 * PACKETSZ, &n2)) {
+		case 1:
+			res_cache_store(statp, nbuf, class, type1, ans1, n1,
+					res_cache_ttl(ans1, n1));
+			res_cache_store(statp, nbuf, class, type2, ans2, n2,
+					res_cache_ttl(ans2, n2));
+			break;
+		case -1:
+			/* Spare the queries that follow another full timeout. */
+			if (errno == ETIMEDOUT) {
+				res_cache_store(statp, nbuf, class, type1,
+						NULL, 0, statp->retrans);
+				res_cache_store(statp, nbuf, class, type2,
+						NULL, 0, statp->retrans);
+			}
+			break;
+		}
+	}
+	__set_errno (saved_errno);
+	RES_SET_H_ERRNO(statp, saved_herrno);
+}
+
 /*
  * Formulate a normal query, send, and retrieve answer in supplied buffer.
  * Return the size of the response on success, -1 on error.
@@ -97,6 +97,7 @@ static const char rcsid[] = "$BINDId: res_send.c,v 8.38 2000/03/30 20:16:51 vixi
 #include <string.h>
 #include <unistd.h>
 #include "libc-symbols.h"
+#include "local.h"
 
 #if PACKETSZ > 65536
 #define MAXPACKET       PACKETSZ
@@ -175,6 +176,9 @@ evNowTime(struct timespec *res) {
 
 #define EXT(res) ((res)->_u._ext)
 
+/* Address family of our datagram sockets; PF_INET once IPv6 failed. */
+static int socket_pf = 0;
+
 /* Forward. */
 
 static int		send_vc(res_state, const u_char *, int,
@@ -182,12 +186,17 @@ static int		send_vc(res_state, const u_char *, int,
 static int		send_dg(res_state, const u_char *, int,
 				u_char **, int *, int *, int,
 				int *, int *, u_char **);
+static int		send_dg2(res_state, const u_char *, int,
+				 const u_char *, int, u_char *, int, int *,
+				 u_char *, int, int *, int *, int, int *);
 #ifdef DEBUG
 static void		Aerror(const res_state, FILE *, const char *, int,
 			       const struct sockaddr *);
 static void		Perror(const res_state, FILE *, const char *, int);
 #endif
 static int		sock_eq(struct sockaddr_in6 *, struct sockaddr_in6 *);
+static int		nameinquery(const u_char *, int, int,
+				    const u_char *, const u_char *);
 
 /* Reachover. */
 
@@ -256,28 +265,39 @@ int
 res_nameinquery(const char *name, int type, int class,
 		const u_char *buf, const u_char *eom)
 {
-	const u_char *cp = buf + HFIXEDSZ;
-	int qdcount = ntohs(((HEADER*)buf)->qdcount);
+	u_char wname[NS_MAXCDNAME];
 
-	while (qdcount-- > 0) {
-		char tname[MAXDNAME+1];
-		int n, ttype, tclass;
+	if (ns_name_pton(name, wname, sizeof wname) < 0)
+		return (0);
+	return (nameinquery(wname, type, class, buf, eom));
+}
+libresolv_hidden_def (res_nameinquery)
 
-		n = dn_expand(buf, eom, cp, tname, sizeof tname);
-		if (n < 0)
-			return (-1);
-		cp += n;
-		if (cp + 2 * INT16SZ > eom)
+/*
+ * res_nameinquery() for an uncompressed name in wire format.  The
+ * question names in BUF are compared in place, not expanded.
+ */
+static int
+nameinquery(const u_char *wname, int type, int class,
+	    const u_char *buf, const u_char *eom)
+{
+	struct __ns_namecmp nc;
+	struct __ns_rrit it;
+	struct __ns_wrr rr;
+	int qdcount, n;
+
+	if (__ns_rrit_init(&it, buf, eom - buf) < 0 ||
+	    __ns_namecmp_init(&nc, buf, eom, wname) < 0)
+		return (-1);
+	for (qdcount = it._counts[ns_s_qd]; qdcount > 0; qdcount--) {
+		if (__ns_rrit_next(&it, &rr) <= 0)
 			return (-1);
-		ttype = ns_get16(cp); cp += INT16SZ;
-		tclass = ns_get16(cp); cp += INT16SZ;
-		if (ttype == type && tclass == class &&
-		    ns_samename(tname, name) == 1)
-			return (1);
+		if (rr.type == type && rr.rr_class == class &&
+		    (n = __ns_namecmp(&nc, rr.name)) != 0)
+			return (n);
 	}
 	return (0);
 }
-libresolv_hidden_def (res_nameinquery)
 
 /* int
  * res_queriesmatch(buf1, eom1, buf2, eom2)
@@ -294,7 +314,8 @@ int
 res_queriesmatch(const u_char *buf1, const u_char *eom1,
 		 const u_char *buf2, const u_char *eom2)
 {
-	const u_char *cp = buf1 + HFIXEDSZ;
+	struct __ns_rrit it;
+	struct __ns_wrr rr;
 	int qdcount = ntohs(((HEADER*)buf1)->qdcount);
 
 	if (buf1 + HFIXEDSZ > eom1 || buf2 + HFIXEDSZ > eom2)
@@ -310,56 +331,30 @@ res_queriesmatch(const u_char *buf1, const u_char *eom1,
 
 	if (qdcount != ntohs(((HEADER*)buf2)->qdcount))
 		return (0);
+	if (__ns_rrit_init(&it, buf1, eom1 - buf1) < 0)
+		return (-1);
 	while (qdcount-- > 0) {
-		char tname[MAXDNAME+1];
-		int n, ttype, tclass;
+		u_char wname[NS_MAXCDNAME];
 
-		n = dn_expand(buf1, eom1, cp, tname, sizeof tname);
-		if (n < 0)
+		if (__ns_rrit_next(&it, &rr) <= 0 ||
+		    ns_name_unpack(buf1, eom1, rr.name, wname,
+				   sizeof wname) < 0)
 			return (-1);
-		cp += n;
-		if (cp + 2 * INT16SZ > eom1)
-			return (-1);
-		ttype = ns_get16(cp);	cp += INT16SZ;
-		tclass = ns_get16(cp); cp += INT16SZ;
-		if (!res_nameinquery(tname, ttype, tclass, buf2, eom2))
+		if (!nameinquery(wname, rr.type, rr.rr_class, buf2, eom2))
 			return (0);
 	}
 	return (1);
 }
 libresolv_hidden_def (res_queriesmatch)
 
-int
-__libc_res_nsend(res_state statp, const u_char *buf, int buflen,
-		 u_char *ans, int anssiz, u_char **ansp)
+/*
+ * Bring our private copy of the ns_addr_list up to date and apply
+ * RES_ROTATE.  Called once per query by both senders.
+ */
+static void
+nsaddrs_setup(res_state statp)
 {
-	int gotsomewhere, terrno, try, v_circuit, resplen, ns, n;
-
-	if (statp->nscount == 0) {
-		__set_errno (ESRCH);
-		return (-1);
-	}
-
-	if (anssiz < HFIXEDSZ) {
-		__set_errno (EINVAL);
-		return (-1);
-	}
-
-	if ((statp->qhook || statp->rhook) && anssiz < MAXPACKET && ansp) {
-		u_char *buf = malloc (MAXPACKET);
-		if (buf == NULL)
-			return (-1);
-		memcpy (buf, ans, HFIXEDSZ);
-		*ansp = buf;
-		ans = buf;
-		anssiz = MAXPACKET;
-	}
-
-	DprintQ((statp->options & RES_DEBUG) || (statp->pfcode & RES_PRF_QUERY),
-		(stdout, ";; res_send()\n"), buf, buflen);
-	v_circuit = (statp->options & RES_USEVC) || buflen > PACKETSZ;
-	gotsomewhere = 0;
-	terrno = ETIMEDOUT;
+	int ns, n;
 
 	/*
 	 * If the ns_addr_list in the resolver context has changed, then
@@ -462,6 +457,41 @@ __libc_res_nsend(res_state statp, const u_char *buf, int buflen,
 			EXT(statp).nsmap[n] = map;
 		}
 	}
+}
+
+int
+__libc_res_nsend(res_state statp, const u_char *buf, int buflen,
+		 u_char *ans, int anssiz, u_char **ansp)
+{
+	int gotsomewhere, terrno, try, v_circuit, resplen, ns, n;
+
+	if (statp->nscount == 0) {
+		__set_errno (ESRCH);
+		return (-1);
+	}
+
+	if (anssiz < HFIXEDSZ) {
+		__set_errno (EINVAL);
+		return (-1);
+	}
+
+	if ((statp->qhook || statp->rhook) && anssiz < MAXPACKET && ansp) {
+		u_char *buf = malloc (MAXPACKET);
+		if (buf == NULL)
+			return (-1);
+		memcpy (buf, ans, HFIXEDSZ);
+		*ansp = buf;
+		ans = buf;
+		anssiz = MAXPACKET;
+	}
+
+	DprintQ((statp->options & RES_DEBUG) || (statp->pfcode & RES_PRF_QUERY),
+		(stdout, ";; res_send()\n"), buf, buflen);
+	v_circuit = (statp->options & RES_USEVC) || buflen > PACKETSZ;
+	gotsomewhere = 0;
+	terrno = ETIMEDOUT;
+
+	nsaddrs_setup(statp);
 
 	/*
 	 * Send request, RETRY times, or until successful.
@@ -610,6 +640,59 @@ res_nsend(res_state statp,
 }
 libresolv_hidden_def (res_nsend)
 
+/*
+ * Send two queries to the same nameservers at once, for lookups that
+ * need both (A and AAAA for getaddrinfo).  Only datagrams are used.
+ * Returns 1 with both answers in place, -1 if no server answered, and 0
+ * if the queries should go out one at a time through res_nsend instead.
+ */
+int
+__libc_res_nsend2(res_state statp,
+		  const u_char *buf1, int buflen1,
+		  const u_char *buf2, int buflen2,
+		  u_char *ans1, int anssiz1, int *resplen1,
+		  u_char *ans2, int anssiz2, int *resplen2)
+{
+	int gotsomewhere, terrno, try, ns, n;
+
+	if (statp->nscount == 0) {
+		__set_errno (ESRCH);
+		return (-1);
+	}
+	if (statp->qhook || statp->rhook || (statp->options & RES_USEVC)
+	    || buflen1 > PACKETSZ || buflen2 > PACKETSZ
+	    || anssiz1 <= PACKETSZ || anssiz2 <= PACKETSZ
+	    || ((HEADER *) buf1)->id == ((HEADER *) buf2)->id)
+		return (0);
+
+	gotsomewhere = 0;
+	terrno = ETIMEDOUT;
+	nsaddrs_setup(statp);
+
+	for (try = 0; try < statp->retry; try++) {
+	    for (ns = 0; ns < MAXNS; ns++) {
+		if (EXT(statp).nsaddrs[ns] == NULL)
+			continue;
+		n = send_dg2(statp, buf1, buflen1, buf2, buflen2,
+			     ans1, anssiz1, resplen1, ans2, anssiz2, resplen2,
+			     &terrno, ns, &gotsomewhere);
+		if (n < 0)
+			return (-1);
+		if (n == 0)
+			continue;
+		if ((statp->options & RES_STAYOPEN) == 0)
+			res_nclose(statp);
+		return (n == 1);
+	    }
+	}
+	res_nclose(statp);
+	if (!gotsomewhere)
+		__set_errno (ECONNREFUSED);	/* no nameservers found */
+	else
+		__set_errno (ETIMEDOUT);	/* no answer obtained */
+	return (-1);
+}
+
 /* Private */
 
 static int
@@ -796,22 +879,15 @@ send_vc(res_state statp,
 	return (resplen);
 }
 
+/*
+ * Open and connect the datagram socket for nameserver NS unless it is
+ * already open.  Returns -1 on a fatal error (with *terrno set), 0 if
+ * the next nameserver should be tried, 1 if the socket is ready.
+ */
 static int
-send_dg(res_state statp,
-	const u_char *buf, int buflen, u_char **ansp, int *anssizp,
-	int *terrno, int ns, int *v_circuit, int *gotsomewhere, u_char **anscp)
+dg_socket(res_state statp, int ns, int *terrno)
 {
-	const HEADER *hp = (HEADER *) buf;
-	u_char *ans = *ansp;
-	int anssiz = *anssizp;
-	HEADER *anhp = (HEADER *) ans;
 	struct sockaddr_in6 *nsap = EXT(statp).nsaddrs[ns];
-	struct timespec now, timeout, finish;
-	struct pollfd pfd[1];
-        int ptimeout;
-	struct sockaddr_in6 from;
-	static int socket_pf = 0;
-	int fromlen, resplen, seconds, n;
 
 	if (EXT(statp).nssocks[ns] == -1) {
 		/* only try IPv6 if IPv6 NS and if not failed before */
@@ -857,6 +933,27 @@ send_dg(res_state statp,
 		Dprint(statp->options & RES_DEBUG,
 		       (stdout, ";; new DG socket\n"))
 	}
+	return (1);
+}
+
+static int
+send_dg(res_state statp,
+	const u_char *buf, int buflen, u_char **ansp, int *anssizp,
+	int *terrno, int ns, int *v_circuit, int *gotsomewhere, u_char **anscp)
+{
+	const HEADER *hp = (HEADER *) buf;
+	u_char *ans = *ansp;
+	int anssiz = *anssizp;
+	HEADER *anhp = (HEADER *) ans;
+	struct timespec now, timeout, finish;
+	struct pollfd pfd[1];
+        int ptimeout;
+	struct sockaddr_in6 from;
+	int fromlen, resplen, seconds, n;
+
+	n = dg_socket(statp, ns, terrno);
+	if (n <= 0)
+		return (n);
 
 	/*
 	 * Compute time for the total operation.
@@ -1037,6 +1134,144 @@ send_dg(res_state statp,
 	}
 }
 
+/*
+ * Like send_dg, for two queries: both go out back to back over the same
+ * socket and the answers are told apart by their IDs.  Returns -1 on a
+ * fatal error, 0 if the next nameserver should be tried, 1 if both
+ * answers are in, and 2 if an answer was truncated and the queries
+ * have to be sent one at a time.
+ */
+static int
+send_dg2(res_state statp,
+	 const u_char *buf1, int buflen1, const u_char *buf2, int buflen2,
+	 u_char *ans1, int anssiz1, int *resplen1,
+	 u_char *ans2, int anssiz2, int *resplen2,
+	 int *terrno, int ns, int *gotsomewhere)
+{
+	const HEADER *hp1 = (HEADER *) buf1;
+	const HEADER *hp2 = (HEADER *) buf2;
+	const HEADER *anhp;
+	struct timespec now, timeout, finish;
+	struct pollfd pfd[1];
+	struct sockaddr_in6 from;
+	int fromlen, resplen, seconds, n, anssiz;
+	int got1 = 0, got2 = 0;
+	u_char *ans;
+
+	n = dg_socket(statp, ns, terrno);
+	if (n <= 0)
+		return (n);
+	pfd[0].fd = EXT(statp).nssocks[ns];
+	pfd[0].events = POLLIN;
+
+	__set_errno (0);
+	if (send(pfd[0].fd, (char*)buf1, buflen1, 0) != buflen1
+	    || send(pfd[0].fd, (char*)buf2, buflen2, 0) != buflen2) {
+		if (errno == EINTR || errno == EAGAIN)
+			return (2);
+		Perror(statp, stderr, "send", errno);
+		res_nclose(statp);
+		return (0);
+	}
+
+	seconds = (statp->retrans << ns);
+	if (ns > 0)
+		seconds /= statp->nscount;
+	if (seconds <= 0)
+		seconds = 1;
+	evNowTime(&now);
+	evConsTime(&timeout, seconds, 0);
+	evAddTime(&finish, &now, &timeout);
+
+	while (!got1 || !got2) {
+		evNowTime(&now);
+		if (evCmpTime(finish, now) <= 0)
+			n = 0;
+		else {
+			evSubTime(&timeout, &finish, &now);
+			n = poll (pfd, 1, timeout.tv_sec * 1000
+				  + timeout.tv_nsec / 1000000);
+		}
+		if (n == 0) {
+			Dprint(statp->options & RES_DEBUG,
+			       (stdout, ";; timeout\n"));
+			*gotsomewhere = 1;
+			return (0);
+		}
+		if (n < 0) {
+			if (errno == EINTR)
+				continue;
+			Perror(statp, stderr, "poll", errno);
+			res_nclose(statp);
+			return (0);
+		}
+		if (!(pfd[0].revents & POLLIN)) {
+			/* Something went wrong.  We can stop trying.  */
+			res_nclose(statp);
+			return (0);
+		}
+
+		/* Until the first answer is in, either may land in ans1. */
+		ans = got1 ? ans2 : ans1;
+		anssiz = got1 ? anssiz2 : anssiz1;
+		fromlen = sizeof(struct sockaddr_in6);
+		resplen = recvfrom(pfd[0].fd, (char*)ans, anssiz, 0,
+				   (struct sockaddr *)&from, &fromlen);
+		if (resplen <= 0) {
+			if (errno == EINTR || errno == EAGAIN)
+				continue;
+			Perror(statp, stderr, "recvfrom", errno);
+			res_nclose(statp);
+			return (0);
+		}
+		*gotsomewhere = 1;
+		if (resplen < HFIXEDSZ) {
+			*terrno = EMSGSIZE;
+			res_nclose(statp);
+			return (0);
+		}
+		anhp = (HEADER *) ans;
+		if (!got1 && anhp->id == hp1->id)
+			n = 1;
+		else if (!got2 && anhp->id == hp2->id)
+			n = 2;
+		else
+			continue;	/* response from old query */
+		if (!(statp->options & RES_INSECURE1) &&
+		    !res_ourserver_p(statp, &from))
+			continue;
+		if (!(statp->options & RES_INSECURE2) &&
+		    (n == 1
+		     ? !res_queriesmatch(buf1, buf1 + buflen1,
+					 ans, ans + anssiz)
+		     : !res_queriesmatch(buf2, buf2 + buflen2,
+					 ans, ans + anssiz)))
+			continue;
+		if (anhp->rcode == SERVFAIL ||
+		    anhp->rcode == NOTIMP ||
+		    anhp->rcode == REFUSED) {
+			res_nclose(statp);
+			return (0);
+		}
+		/* A full buffer may mean the datagram was cut short. */
+		if (anhp->tc || resplen >= anssiz)
+			return (2);
+		if (n == 1) {
+			*resplen1 = resplen;
+			got1 = 1;
+		} else {
+			if (ans != ans2) {
+				if (resplen >= anssiz2)
+					return (2);
+				memcpy(ans2, ans, resplen);
+			}
+			*resplen2 = resplen;
+			got2 = 1;
+		}
+	}
+	return (1);
+}
+
 #ifdef DEBUG
 static void
 Aerror(const res_state statp, FILE *file, const char *string, int error,
@@ -8,85 +8,265 @@
 #include <string.h>
 #include <limits.h>
 #include <errno.h>
+#include <sys/param.h>
 #include <sys/stat.h>
 
+#define _LIBC 1
+#include <sys/lock.h>
 
-/* FIXME: buffer overrun possible, loops forever on cyclic symlinks */
+
+#ifndef MAXSYMLINKS
+#define MAXSYMLINKS 20
+#endif
 
 
 /*
- * Canonical name: never ends with a slash
+ * Optional cache of names already resolved: canonical names of
+ * directories (never symbolic links) and the current directory.  It
+ * is off unless the environment variable REALPATH_CACHE gives the
+ * number of directory entries to keep.  The cache is flushed by the
+ * calls in libc which may change what a name refers to (see inode.c
+ * and rename.c), but it cannot see other processes doing so, hence
+ * the opt-in.  The last component of a name is always looked up, so
+ * a name that has gone away is still reported as such.
  */
 
-static int resolve_path(char *path,char *result,char *pos)
+#define CACHE_MAX 65536
+
+struct cache_ent {
+    unsigned long hash;
+    char *path;
+};
+
+static struct cache_ent *cache;
+static unsigned cache_size;	/* 0 if the cache is off */
+static int cache_checked;	/* REALPATH_CACHE has been looked at */
+static unsigned long cache_gen;	/* bumped by every flush */
+static char *cache_cwd;
+
+__LOCK_INIT(static, cache_lock);
+
+
+static unsigned long hash_path(const char *path,size_t len)
 {
-    if (*path == '/') {
-	*result = '/';
-	pos = result+1;
-	path++;
-    }
-    *pos = 0;
-    if (!*path) return 0;
-    while (1) {
-	char *slash;
-	struct stat st;
-
-	slash = *path ? strchr(path,'/') : NULL;
-	if (slash) *slash = 0;
-	if (!path[0] || (path[0] == '.' &&
-	  (!path[1] || (path[1] == '.' && !path[2])))) {
-	    pos--;
-	    if (pos != result && path[0] && path[1])
-		while (*--pos != '/');
+    unsigned long h = 0;
+
+    while (len--) h = h*31+(unsigned char) *path++;
+    return h;
+}
+
+
+static void cache_setup(void)
+{
+    const char *s;
+    unsigned size;
+
+    __lock_acquire(cache_lock);
+    if (!cache_checked) {
+	s = getenv("REALPATH_CACHE");
+	size = s ? strtoul(s,NULL,0) : 0;
+	if (size > CACHE_MAX) size = CACHE_MAX;
+	if (size) {
+	    cache = calloc(size,sizeof(struct cache_ent));
+	    if (cache) cache_size = size;
 	}
-	else {
-	    strcpy(pos,path);
-	    if (lstat(result,&st) < 0) return -1;
-	    if (S_ISLNK(st.st_mode)) {
-		char buf[PATH_MAX];
+	cache_checked = 1;
+    }
+    __lock_release(cache_lock);
+}
 
-		if (readlink(result,buf,sizeof(buf)) < 0) return -1;
-		*pos = 0;
-		if (slash) {
-		    *slash = '/';
-		    strcat(buf,slash);
-		}
-		strcpy(path,buf);
-		if (*path == '/') result[1] = 0;
-		pos = strchr(result,0);
-		continue;
-	    }
-	    pos = strchr(result,0);
+
+/* Called with the cache on: is PATH a known directory ?  */
+
+static int cache_lookup(const char *path,size_t len)
+{
+    unsigned long h = hash_path(path,len);
+    struct cache_ent *ent = cache+h % cache_size;
+    int found;
+
+    __lock_acquire(cache_lock);
+    found = ent->path && ent->hash == h && !strcmp(ent->path,path);
+    __lock_release(cache_lock);
+    return found;
+}
+
+
+/* Remember PATH as a directory, unless the cache was flushed since GEN.  */
+
+static void cache_insert(const char *path,size_t len,unsigned long gen)
+{
+    unsigned long h = hash_path(path,len);
+    struct cache_ent *ent = cache+h % cache_size;
+    char *copy;
+
+    copy = malloc(len+1);
+    if (!copy) return;
+    memcpy(copy,path,len+1);
+    __lock_acquire(cache_lock);
+    if (gen == cache_gen) {
+	free(ent->path);
+	ent->hash = h;
+	ent->path = copy;
+	copy = NULL;
+    }
+    __lock_release(cache_lock);
+    free(copy);
+}
+
+
+/* Put the current directory, which getcwd returns canonical, into BUF.  */
+
+static int get_cwd(char *buf,unsigned long gen)
+{
+    char *copy;
+    int found = 0;
+
+    if (cache_size) {
+	__lock_acquire(cache_lock);
+	if (cache_cwd) {
+	    strcpy(buf,cache_cwd);
+	    found = 1;
 	}
-	if (slash) {
-	    *pos++ = '/';
-	    path = slash+1;
+	__lock_release(cache_lock);
+	if (found) return 0;
+    }
+    if (!getcwd(buf,PATH_MAX)) return -1;
+    if (cache_size && (copy = strdup(buf))) {
+	__lock_acquire(cache_lock);
+	if (gen == cache_gen && !cache_cwd) {
+	    cache_cwd = copy;
+	    copy = NULL;
 	}
-	*pos = 0;
-	if (!slash) break;
+	__lock_release(cache_lock);
+	free(copy);
     }
     return 0;
 }
 
 
+/* Forget the current directory, and unless CWD_ONLY all directories.  */
+
+void __realpath_cache_flush(int cwd_only)
+{
+    unsigned i;
+
+    if (!cache_size) return;
+    __lock_acquire(cache_lock);
+    cache_gen++;
+    free(cache_cwd);
+    cache_cwd = NULL;
+    if (!cwd_only)
+	for (i = 0; i != cache_size; i++) {
+	    free(cache[i].path);
+	    cache[i].path = NULL;
+	}
+    __lock_release(cache_lock);
+}
+
+
+/*
+ * Canonical name: never ends with a slash, except for the root.  POS
+ * always points to the end of the name built so far, so every step
+ * costs the length of the component only.
+ */
+
 char *realpath(const char *__restrict path,char *__restrict resolved_path)
 {
-    char cwd[PATH_MAX];
-    char *path_copy;
-    int res;
+    char rest[PATH_MAX],buf[PATH_MAX];
+    char *result,*pos,*prev,*p,*start;
+    unsigned long gen;
+    size_t len,tail;
+    struct stat st;
+    int links = 0;
+    int more;
+    ssize_t n;
 
+    if (!path) {
+	errno = EINVAL;
+	return NULL;
+    }
     if (!*path) {
 	errno = ENOENT; /* SUSv2 */
 	return NULL;
     }
-    if (!getcwd(cwd,sizeof(cwd))) return NULL;
-    strcpy(resolved_path,"/");
-    if (resolve_path(cwd,resolved_path,resolved_path)) return NULL;
-    strcat(resolved_path,"/");
-    path_copy = strdup(path);
-    if (!path_copy) return NULL;
-    res = resolve_path(path_copy,resolved_path,strchr(resolved_path,0));
-    free(path_copy);
-    if (res) return NULL;
-    return resolved_path;
+    len = strlen(path);
+    if (len >= PATH_MAX) {
+	errno = ENAMETOOLONG;
+	return NULL;
+    }
+    memcpy(rest,path,len+1);
+
+    if (!cache_checked) cache_setup();
+    gen = cache_gen;
+
+    result = resolved_path ? resolved_path : malloc(PATH_MAX);
+    if (!result) return NULL;
+    if (*rest == '/') strcpy(result,"/");
+    else if (get_cwd(result,gen) < 0) goto fail;
+    pos = strchr(result,0);
+
+    p = rest;
+    while (1) {
+	while (*p == '/') p++;
+	if (!*p) break;
+	start = p;
+	while (*p && *p != '/') p++;
+	len = p-start;
+	if (len == 1 && *start == '.') continue;
+	if (len == 2 && start[0] == '.' && start[1] == '.') {
+	    if (pos != result+1) {
+		while (*--pos != '/');
+		if (pos == result) pos++;
+		*pos = 0;
+	    }
+	    continue;
+	}
+
+	prev = pos;
+	if (pos-result+1+len >= PATH_MAX) {
+	    errno = ENAMETOOLONG;
+	    goto fail;
+	}
+	if (pos != result+1) *pos++ = '/';
+	memcpy(pos,start,len);
+	pos += len;
+	*pos = 0;
+
+	/* anything following, even just a slash, must be a directory */
+	more = *p != 0;
+	if (more && cache_size && cache_lookup(result,pos-result)) continue;
+	if (lstat(result,&st) < 0) goto fail;
+	if (S_ISLNK(st.st_mode)) {
+	    if (++links > MAXSYMLINKS) {
+		errno = ELOOP;
+		goto fail;
+	    }
+	    n = readlink(result,buf,sizeof(buf));
+	    if (n < 0) goto fail;
+	    tail = strlen(p);
+	    if (n+tail >= PATH_MAX) {
+		errno = ENAMETOOLONG;
+		goto fail;
+	    }
+	    memmove(rest+n,p,tail+1);
+	    memcpy(rest,buf,n);
+	    p = rest;
+	    if (*rest == '/') pos = result+1;
+	    else pos = prev;
+	    *pos = 0;
+	    continue;
+	}
+	if (more) {
+	    if (!S_ISDIR(st.st_mode)) {
+		errno = ENOTDIR;
+		goto fail;
+	    }
+	    if (cache_size) cache_insert(result,pos-result,gen);
+	}
+    }
+    return result;
+
+fail:
+    if (!resolved_path) free(result);
+    return NULL;
 }
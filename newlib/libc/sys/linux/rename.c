@@ -5,5 +5,22 @@
 #include <stdio.h>
 #include <machine/syscall.h>
 
-_syscall2(int,rename,const char *,old,const char *,new)
+#define __NR___rename __NR_rename
+
+/* only there if realpath is linked in */
+extern void __realpath_cache_flush (int cwd_only) __attribute__ ((weak));
+
+static _syscall2_base(int,__rename,const char *,old,const char *,new)
+
+int
+__libc_rename (const char *old, const char *new)
+{
+  int ret = __libc___rename (old, new);
+
+  /* a directory may have moved, see realpath.c */
+  if (ret == 0 && __realpath_cache_flush)
+    __realpath_cache_flush (0);
+  return ret;
+}
+weak_alias(__libc_rename,rename)
 
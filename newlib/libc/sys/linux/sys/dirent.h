@@ -15,9 +15,23 @@
 
 #define HAVE_NO_D_NAMLEN	/* no struct dirent->d_namlen */
 #define HAVE_DD_LOCK  		/* have locking mechanism */
+#define DIRBUFSIZ 32768		/* dd_buf size, read by one getdents */
 
 #define MAXNAMLEN 255		/* sizeof(struct dirent.d_name)-1 */
 
+/* File types for d_type.  Only readdir64() fills it in; readdir() uses the
+   old getdents call, which has no type, so HAVE_READDIR_D_TYPE (readdir()
+   sets d_type) is not defined here.  */
+#define DT_UNKNOWN	0
+#define DT_FIFO		1
+#define DT_CHR		2
+#define DT_DIR		4
+#define DT_BLK		6
+#define DT_REG		8
+#define DT_LNK		10
+#define DT_SOCK		12
+#define DT_WHT		14
+
 
 typedef struct {
     int dd_fd;		/* directory file */
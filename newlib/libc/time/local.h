@@ -27,6 +27,13 @@ extern const int __month_lengths[2][MONSPERYEAR];
 void _tzset_unlocked_r (struct _reent *);
 void _tzset_unlocked (void);
 
+#ifdef HAVE_TZFILE
+int __tzfile_load_r (struct _reent *, const char *, char **);
+void __tzfile_unload (struct _reent *);
+int __tzfile_offset (time_t, long *, int *);
+int __tzfile_local_offset (time_t, int, long *, int *);
+#endif
+
 /* locks for multi-threading */
 #ifdef __SINGLE_THREAD__
 #define TZ_LOCK
@@ -15,14 +15,17 @@
 
 /*
 FUNCTION
-<<mktime>>---convert time to arithmetic representation
+<<mktime>>, <<timegm>>---convert time to arithmetic representation
 
 INDEX
 	mktime
+INDEX
+	timegm
 
 SYNOPSIS
 	#include <time.h>
 	time_t mktime(struct tm *<[timp]>);
+	time_t timegm(struct tm *<[timp]>);
 
 DESCRIPTION
 <<mktime>> assumes the time at <[timp]> is a local time, and converts
@@ -31,15 +34,18 @@ its representation from the traditional representation defined by
 
 <<localtime>> is the inverse of <<mktime>>.
 
+<<timegm>> is like <<mktime>>, but takes the time at <[timp]> to be
+Coordinated Universal Time.  <<gmtime>> is its inverse.
+
 RETURNS
 If the contents of the structure at <[timp]> do not form a valid
 calendar time representation, the result is <<-1>>.  Otherwise, the
 result is the time, converted to a <<time_t>> value.
 
 PORTABILITY
-ANSI C requires <<mktime>>.
+ANSI C requires <<mktime>>.  <<timegm>> is a BSD and GNU extension.
 
-<<mktime>> requires no supporting OS subroutines.
+<<mktime>> and <<timegm>> require no supporting OS subroutines.
 */
 
 #include <stdlib.h>
@@ -61,6 +67,44 @@ static const int _DAYS_BEFORE_MONTH[12] =
 #define _ISLEAP(y) (((y) % 4) == 0 && (((y) % 100) != 0 || (((y)+1900) % 400) == 0))
 #define _DAYS_IN_YEAR(year) (_ISLEAP(year) ? 366 : 365)
 
+/* Dates are computed in 400-year eras starting on 1 March of years
+   divisible by 400, with the algorithms described at
+   http://howardhinnant.github.io/date_algorithms.html (see also
+   gmtime_r.c).  Era 0 starts on 1 March 2000, which is tm_year 100.  */
+#define DAYS_PER_ERA		146097L
+#define ERA_BASE_TM_YEAR	100
+/* days from 1 January 1970 to 1 March 2000 */
+#define ERA_BASE_DAYS		11017L
+
+/* Return the day of the era on which month MON (in [0, 11]) of tm_year
+   YEAR starts, and store the era in *ERA.  */
+static long
+era_day (int year, int mon, long *era)
+{
+  long y = (long) year - ERA_BASE_TM_YEAR - (mon < 2);
+  long yoe;
+
+  *era = (y >= 0 ? y : y - 399) / 400;
+  yoe = y - *era * 400;				/* [0, 399] */
+  return yoe * 365 + yoe / 4 - yoe / 100
+	 + (153 * (mon > 1 ? mon - 2 : mon + 10) + 2) / 5;
+}
+
+/* Set the tm_year, tm_mon and tm_mday fields from day DOE of era ERA.  */
+static void
+era_to_civil (struct tm *tim_p, long era, long doe)
+{
+  long yoe, doy, mp;
+
+  yoe = (doe - doe / 1460 + doe / 36524 - doe / (DAYS_PER_ERA - 1)) / 365;
+  doy = doe - (365 * yoe + yoe / 4 - yoe / 100);	/* [0, 365] */
+  mp = (5 * doy + 2) / 153;				/* [0, 11] from March */
+  tim_p->tm_mday = (int) (doy - (153 * mp + 2) / 5 + 1);
+  tim_p->tm_mon = (int) (mp < 10 ? mp + 2 : mp - 10);
+  tim_p->tm_year = (int) (era * 400 + yoe + ERA_BASE_TM_YEAR
+			  + (tim_p->tm_mon < 2));
+}
+
 static void 
 validate_structure (struct tm *tim_p)
 {
@@ -115,85 +159,113 @@ validate_structure (struct tm *tim_p)
   if (_DAYS_IN_YEAR (tim_p->tm_year) == 366)
     days_in_feb = 29;
 
-  if (tim_p->tm_mday <= 0)
+  if (tim_p->tm_mday <= 0 || tim_p->tm_mday > _DAYS_IN_MONTH (tim_p->tm_mon))
     {
-      while (tim_p->tm_mday <= 0)
+      /* Carry whole eras separately so that the day count stays small.  */
+      long era, doe, eras, rem;
+
+      doe = era_day (tim_p->tm_year, tim_p->tm_mon, &era);
+      eras = (tim_p->tm_mday - 1L) / DAYS_PER_ERA;
+      rem = (tim_p->tm_mday - 1L) % DAYS_PER_ERA;
+      if (rem < 0)
 	{
-	  if (--tim_p->tm_mon == -1)
-	    {
-	      tim_p->tm_year--;
-	      tim_p->tm_mon = 11;
-	      days_in_feb =
-		((_DAYS_IN_YEAR (tim_p->tm_year) == 366) ?
-		 29 : 28);
-	    }
-	  tim_p->tm_mday += _DAYS_IN_MONTH (tim_p->tm_mon);
+	  rem += DAYS_PER_ERA;
+	  --eras;
 	}
-    }
-  else
-    {
-      while (tim_p->tm_mday > _DAYS_IN_MONTH (tim_p->tm_mon))
+      doe += rem;
+      if (doe >= DAYS_PER_ERA)
 	{
-	  tim_p->tm_mday -= _DAYS_IN_MONTH (tim_p->tm_mon);
-	  if (++tim_p->tm_mon == 12)
-	    {
-	      tim_p->tm_year++;
-	      tim_p->tm_mon = 0;
-	      days_in_feb =
-		((_DAYS_IN_YEAR (tim_p->tm_year) == 366) ?
-		 29 : 28);
-	    }
+	  doe -= DAYS_PER_ERA;
+	  ++eras;
 	}
+      era_to_civil (tim_p, era + eras, doe);
     }
 }
 
-time_t 
-mktime (struct tm *tim_p)
+/* Normalize *TIM_P and set tm_yday.  Store in *DAYS the number of days
+   from the epoch to the date it represents and in *TIM the seconds since
+   the epoch for the fields taken as UTC.  Return 0 if the year is out of
+   range.  */
+static int
+tm_to_utc (struct tm *tim_p, long *days, time_t *tim)
 {
-  time_t tim = 0;
-  long days = 0;
-  int year, isdst=0;
-  __tzinfo_type *tz = __gettzinfo ();
+  long era, doe;
 
-  /* validate structure */
   validate_structure (tim_p);
 
-  /* compute hours, minutes, seconds */
-  tim += tim_p->tm_sec + (tim_p->tm_min * _SEC_IN_MINUTE) +
-    (tim_p->tm_hour * _SEC_IN_HOUR);
-
-  /* compute days in year */
-  days += tim_p->tm_mday - 1;
-  days += _DAYS_BEFORE_MONTH[tim_p->tm_mon];
-  if (tim_p->tm_mon > 1 && _DAYS_IN_YEAR (tim_p->tm_year) == 366)
-    days++;
-
   /* compute day of the year */
-  tim_p->tm_yday = days;
+  tim_p->tm_yday = _DAYS_BEFORE_MONTH[tim_p->tm_mon] + tim_p->tm_mday - 1;
+  if (tim_p->tm_mon > 1 && _DAYS_IN_YEAR (tim_p->tm_year) == 366)
+    tim_p->tm_yday++;
 
   if (tim_p->tm_year > 10000 || tim_p->tm_year < -10000)
-      return (time_t) -1;
+      return 0;
 
-  /* compute days in other years */
-  if ((year = tim_p->tm_year) > 70)
-    {
-      for (year = 70; year < tim_p->tm_year; year++)
-	days += _DAYS_IN_YEAR (year);
-    }
-  else if (year < 70)
-    {
-      for (year = 69; year > tim_p->tm_year; year--)
-	days -= _DAYS_IN_YEAR (year);
-      days -= _DAYS_IN_YEAR (year);
-    }
+  doe = era_day (tim_p->tm_year, tim_p->tm_mon, &era);
+  *days = era * DAYS_PER_ERA + doe + tim_p->tm_mday - 1 + ERA_BASE_DAYS;
+
+  *tim = tim_p->tm_sec + (tim_p->tm_min * _SEC_IN_MINUTE) +
+    (tim_p->tm_hour * _SEC_IN_HOUR) + (time_t) *days * _SEC_IN_DAY;
+  return 1;
+}
+
+time_t
+timegm (struct tm *tim_p)
+{
+  long days;
+  time_t tim;
+
+  if (!tm_to_utc (tim_p, &days, &tim))
+    return (time_t) -1;
+
+  tim_p->tm_isdst = 0;
+
+  /* compute day of the week */
+  if ((tim_p->tm_wday = (days + 4) % 7) < 0)
+    tim_p->tm_wday += 7;
 
-  /* compute total seconds */
-  tim += (time_t)days * _SEC_IN_DAY;
+  return tim;
+}
+
+time_t 
+mktime (struct tm *tim_p)
+{
+  time_t tim;
+  long days = 0;
+  int year, isdst=0;
+  __tzinfo_type *tz = __gettzinfo ();
+
+  /* normalize the structure and compute the time as if it were UTC */
+  if (!tm_to_utc (tim_p, &days, &tim))
+      return (time_t) -1;
+  year = tim_p->tm_year;
 
   TZ_LOCK;
 
   _tzset_unlocked ();
 
+#ifdef HAVE_TZFILE
+  {
+    long offset;
+    time_t lcl = tim;
+
+    if (__tzfile_local_offset (tim, tim_p->tm_isdst > 0 ? 1 : tim_p->tm_isdst,
+			       &offset, &isdst))
+      {
+	tim += (time_t) offset;
+	if (__tzfile_offset (tim, &offset, &isdst))
+	  lcl = tim - (time_t) offset;
+	TZ_UNLOCK;
+
+	/* A time in a gap, or a tm_isdst that had to be corrected, moves
+	   the wall clock time; refill the structure from the result.  */
+	gmtime_r (&lcl, tim_p);
+	tim_p->tm_isdst = isdst;
+	return tim;
+      }
+  }
+#endif
+
   if (_daylight)
     {
       int tm_isdst;
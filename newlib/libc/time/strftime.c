@@ -280,6 +280,7 @@ locale, hard-coding the "C" locale settings.
 #include <limits.h>
 #include <ctype.h>
 #include <wctype.h>
+#include <sys/lock.h>
 #include "local.h"
 #include "../locale/setlocale.h"
 
@@ -301,6 +302,7 @@ locale, hard-coding the "C" locale settings.
 #  define STRCPY(a,b)	strcpy((a),(b))
 #  define STRCHR(a,b)	strchr((a),(b))
 #  define STRLEN(a)	strlen(a)
+#  define STRCMP(a,b)	strcmp((a),(b))
 # else
 #  define strftime	wcsftime	/* Alternate function name */
 #  define strftime_l	wcsftime_l	/* Alternate function name */
@@ -313,6 +315,7 @@ locale, hard-coding the "C" locale settings.
 #  define STRCPY(a,b)	wcscpy((a),(b))
 #  define STRCHR(a,b)	wcschr((a),(b))
 #  define STRLEN(a)	wcslen(a)
+#  define STRCMP(a,b)	wcscmp((a),(b))
 #  define SFLG		"l"		/* %s flag (l for wide char) */
 #  ifdef __HAVE_LOCALE_INFO_EXTENDED__
 #   define _ctloc(x)    (ctloclen = wcslen (ctloc = _CurrentTimeLocale->w##x))
@@ -1425,6 +1428,349 @@ recurse:
   return count;
 }
 
+#if !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+/* Compiled formats.  A format is translated once into a list of
+   operations: runs of literal text, plain numeric conversions that are
+   rendered from a table of two-digit strings, and everything else (names,
+   locale formats, flags, widths, E and O modifiers, time zones), which is
+   handed to __strftime one conversion at a time.  strftime and strftime_l
+   keep the most recently used compiled formats in a small cache.  */
+
+#ifndef _WANT_C99_TIME_FORMATS
+typedef void era_info_t;
+typedef void alt_digits_t;
+#endif
+
+#define SF_MAXFMT	48	/* longest format kept in the cache */
+#define SF_MAXOPS	24	/* most operations per compiled format */
+#define SF_CACHE	4	/* number of cached formats */
+#define SF_SPECBUF	16	/* longest conversion passed to __strftime */
+#define SF_OUTBUF	128	/* output buffer for a single conversion */
+
+enum
+{
+  SF_LIT,	/* literal text at fmt[off], len characters */
+  SF_SPEC,	/* conversion at fmt[off], len characters, via __strftime */
+  SF_NUM2,	/* field, zero padded to two digits */
+  SF_SPC2,	/* field, space padded to two digits */
+  SF_YDAY,	/* %j */
+  SF_YEAR,	/* %Y */
+  SF_DATE,	/* %D */
+  SF_ISODATE,	/* %F */
+  SF_HM,	/* %R */
+  SF_HMS,	/* %T */
+  SF_WDAY,	/* %w, or %u if field is 7 */
+  SF_CHAR	/* field holds the character to output */
+};
+
+enum
+{
+  SF_SEC, SF_MIN, SF_HOUR, SF_HOUR12, SF_MDAY, SF_MON, SF_YEAR2
+};
+
+struct sf_op
+{
+  unsigned char op;
+  unsigned char field;
+  unsigned char off;
+  unsigned char len;
+};
+
+struct sf_format
+{
+  CHAR fmt[SF_MAXFMT];
+  int nops;
+  struct sf_op ops[SF_MAXOPS];
+};
+
+static const char sf_digits[] =
+  "00010203040506070809101112131415161718192021222324"
+  "25262728293031323334353637383940414243444546474849"
+  "50515253545556575859606162636465666768697071727374"
+  "75767778798081828384858687888990919293949596979899";
+
+#if defined (__SINGLE_THREAD__)
+#define SF_LOCK
+#define SF_UNLOCK
+#elif defined (_RETARGETABLE_LOCKING)
+/* Retargeted ports supply a fixed set of static locks, so borrow the
+   timezone lock instead of adding one.  */
+#define SF_LOCK		TZ_LOCK
+#define SF_UNLOCK	TZ_UNLOCK
+#else
+__LOCK_INIT(static, sf_cache_lock);
+#define SF_LOCK		__lock_acquire (sf_cache_lock)
+#define SF_UNLOCK	__lock_release (sf_cache_lock)
+#endif
+static struct sf_format sf_cache[SF_CACHE];
+static unsigned int sf_cache_next;
+
+/* Translate FORMAT into CF.  Return 0 if it cannot be compiled, in which
+   case the caller uses __strftime directly.  */
+static int
+sf_compile (struct sf_format *cf, const CHAR *format)
+{
+  const CHAR *f = format, *start;
+  struct sf_op *op;
+  size_t flen = STRLEN (format);
+
+  if (flen >= SF_MAXFMT)
+    return 0;
+  memcpy (cf->fmt, format, (flen + 1) * sizeof (CHAR));
+  cf->nops = 0;
+  while (*f)
+    {
+      if (cf->nops == SF_MAXOPS)
+	return 0;
+      op = &cf->ops[cf->nops++];
+      start = f;
+      op->off = f - format;
+      if (*f != CQ('%'))
+	{
+	  while (*f && *f != CQ('%'))
+	    ++f;
+	  op->op = SF_LIT;
+	  op->len = f - start;
+	  continue;
+	}
+      ++f;
+      op->op = SF_SPEC;
+      if (*f == CQ('0') || *f == CQ('+'))
+	++f;
+      while (*f >= CQ('0') && *f <= CQ('9'))
+	++f;
+      if (*f == CQ('E') || *f == CQ('O'))
+	++f;
+      if (f == start + 1)
+	switch (*f)
+	  {
+	  case CQ('d'): op->op = SF_NUM2; op->field = SF_MDAY; break;
+	  case CQ('e'): op->op = SF_SPC2; op->field = SF_MDAY; break;
+	  case CQ('H'): op->op = SF_NUM2; op->field = SF_HOUR; break;
+	  case CQ('k'): op->op = SF_SPC2; op->field = SF_HOUR; break;
+	  case CQ('I'): op->op = SF_NUM2; op->field = SF_HOUR12; break;
+	  case CQ('l'): op->op = SF_SPC2; op->field = SF_HOUR12; break;
+	  case CQ('m'): op->op = SF_NUM2; op->field = SF_MON; break;
+	  case CQ('M'): op->op = SF_NUM2; op->field = SF_MIN; break;
+	  case CQ('S'): op->op = SF_NUM2; op->field = SF_SEC; break;
+	  case CQ('y'): op->op = SF_NUM2; op->field = SF_YEAR2; break;
+	  case CQ('j'): op->op = SF_YDAY; break;
+	  case CQ('Y'): op->op = SF_YEAR; break;
+	  case CQ('D'): op->op = SF_DATE; break;
+	  case CQ('F'): op->op = SF_ISODATE; break;
+	  case CQ('R'): op->op = SF_HM; break;
+	  case CQ('T'): op->op = SF_HMS; break;
+	  case CQ('w'): op->op = SF_WDAY; op->field = 0; break;
+	  case CQ('u'): op->op = SF_WDAY; op->field = 7; break;
+	  case CQ('n'): op->op = SF_CHAR; op->field = '\n'; break;
+	  case CQ('t'): op->op = SF_CHAR; op->field = '\t'; break;
+	  case CQ('%'): op->op = SF_CHAR; op->field = '%'; break;
+	  }
+      /* Leave unknown or truncated conversions to __strftime, which
+	 rejects them.  */
+      if (*f == CQ('\0')
+	  || (op->op == SF_SPEC
+	      && !STRCHR (CQ("aAbBcCdDeFgGhHIjklmMnpPrRsStTuUVwWxXyYzZ%"), *f)))
+	return 0;
+      ++f;
+      op->len = f - start;
+      if (op->len >= SF_SPECBUF)
+	return 0;
+    }
+  return 1;
+}
+
+static int
+sf_field (const struct tm *tim_p, int field)
+{
+  switch (field)
+    {
+    case SF_SEC:
+      return tim_p->tm_sec;
+    case SF_MIN:
+      return tim_p->tm_min;
+    case SF_HOUR:
+      return tim_p->tm_hour;
+    case SF_HOUR12:
+      return (tim_p->tm_hour == 0 || tim_p->tm_hour == 12)
+	     ? 12 : tim_p->tm_hour % 12;
+    case SF_MDAY:
+      return tim_p->tm_mday;
+    case SF_MON:
+      return tim_p->tm_mon + 1;
+    default:
+      return tim_p->tm_year >= 0 ? tim_p->tm_year % 100
+	     : abs (tim_p->tm_year + YEAR_BASE) % 100;
+    }
+}
+
+/* Store the two digits of V, which must be in [0, 99], at P.  If SPACE,
+   a leading zero is replaced by a blank.  */
+static inline CHAR *
+sf_put2 (CHAR *p, int v, int space)
+{
+  p[0] = (space && v < 10) ? CQ(' ') : (CHAR) sf_digits[2 * v];
+  p[1] = (CHAR) sf_digits[2 * v + 1];
+  return p + 2;
+}
+
+#define SF_IN2(v)	((unsigned) (v) <= 99)
+
+/* Render the compiled format CF.  Returns (size_t) -1 if a conversion
+   could not be rendered, so that the caller can fall back to
+   __strftime.  */
+static size_t
+sf_render (CHAR *s, size_t maxsize, const struct sf_format *cf,
+	   const struct tm *tim_p, struct __locale_t *locale,
+	   era_info_t **era_info, alt_digits_t **alt_digits)
+{
+  CHAR buf[SF_OUTBUF], spec[SF_SPECBUF];
+  CHAR *p;
+  const struct sf_op *op;
+  size_t count = 0, len;
+  int i, v, year;
+
+  for (i = 0; i < cf->nops; ++i)
+    {
+      op = &cf->ops[i];
+      p = buf;
+      switch (op->op)
+	{
+	case SF_LIT:
+	  if (count + op->len >= maxsize)
+	    return 0;
+	  memcpy (&s[count], &cf->fmt[op->off], op->len * sizeof (CHAR));
+	  count += op->len;
+	  continue;
+	case SF_NUM2:
+	case SF_SPC2:
+	  v = sf_field (tim_p, op->field);
+	  if (!SF_IN2 (v))
+	    goto spec;
+	  p = sf_put2 (p, v, op->op == SF_SPC2);
+	  break;
+	case SF_YDAY:
+	  v = tim_p->tm_yday + 1;
+	  if (v < 0 || v > 999)
+	    goto spec;
+	  *p++ = CQ('0') + v / 100;
+	  p = sf_put2 (p, v % 100, 0);
+	  break;
+	case SF_YEAR:
+	case SF_ISODATE:
+	  /* %Y has no minimum width, %F pads the year to four digits.  */
+	  year = tim_p->tm_year + YEAR_BASE;
+	  if (tim_p->tm_year > 9999 - YEAR_BASE
+	      || year < (op->op == SF_YEAR ? 1000 : 0))
+	    goto spec;
+	  p = sf_put2 (p, year / 100, 0);
+	  p = sf_put2 (p, year % 100, 0);
+	  if (op->op == SF_YEAR)
+	    break;
+	  if (!SF_IN2 (tim_p->tm_mon + 1) || !SF_IN2 (tim_p->tm_mday))
+	    goto spec;
+	  *p++ = CQ('-');
+	  p = sf_put2 (p, tim_p->tm_mon + 1, 0);
+	  *p++ = CQ('-');
+	  p = sf_put2 (p, tim_p->tm_mday, 0);
+	  break;
+	case SF_DATE:
+	  if (!SF_IN2 (tim_p->tm_mon + 1) || !SF_IN2 (tim_p->tm_mday))
+	    goto spec;
+	  p = sf_put2 (p, tim_p->tm_mon + 1, 0);
+	  *p++ = CQ('/');
+	  p = sf_put2 (p, tim_p->tm_mday, 0);
+	  *p++ = CQ('/');
+	  p = sf_put2 (p, sf_field (tim_p, SF_YEAR2), 0);
+	  break;
+	case SF_HM:
+	case SF_HMS:
+	  if (!SF_IN2 (tim_p->tm_hour) || !SF_IN2 (tim_p->tm_min)
+	      || !SF_IN2 (tim_p->tm_sec))
+	    goto spec;
+	  p = sf_put2 (p, tim_p->tm_hour, 0);
+	  *p++ = CQ(':');
+	  p = sf_put2 (p, tim_p->tm_min, 0);
+	  if (op->op == SF_HM)
+	    break;
+	  *p++ = CQ(':');
+	  p = sf_put2 (p, tim_p->tm_sec, 0);
+	  break;
+	case SF_WDAY:
+	  v = tim_p->tm_wday;
+	  *p++ = CQ('0') + (v == 0 && op->field ? op->field : v);
+	  break;
+	case SF_CHAR:
+	  *p++ = (CHAR) op->field;
+	  break;
+	default:
+	spec:
+	  memcpy (spec, &cf->fmt[op->off], op->len * sizeof (CHAR));
+	  spec[op->len] = CQ('\0');
+	  /* An empty result is valid (e.g. %Z with a negative tm_isdst), so
+	     tell it apart from failure by the terminating NUL.  */
+	  buf[0] = CQ('%');
+	  len = __strftime (buf, SF_OUTBUF, spec, tim_p, locale,
+			    era_info, alt_digits);
+	  if (len == 0 && buf[0] != CQ('\0'))
+	    return (size_t) -1;
+	  p = buf + len;
+	  break;
+	}
+      len = p - buf;
+      if (count + len >= maxsize)
+	return 0;
+      memcpy (&s[count], buf, len * sizeof (CHAR));
+      count += len;
+    }
+  s[count] = CQ('\0');
+  return count;
+}
+
+/* __strftime by way of the compiled format cache.  */
+static size_t
+sf_strftime (CHAR *s, size_t maxsize, const CHAR *format,
+	     const struct tm *tim_p, struct __locale_t *locale,
+	     era_info_t **era_info, alt_digits_t **alt_digits)
+{
+  struct sf_format cf;
+  size_t ret;
+  int i;
+
+  if (maxsize == 0)
+    return __strftime (s, maxsize, format, tim_p, locale,
+		       era_info, alt_digits);
+
+  SF_LOCK;
+  for (i = 0; i < SF_CACHE; ++i)
+    if (sf_cache[i].nops && STRCMP (sf_cache[i].fmt, format) == 0)
+      {
+	cf = sf_cache[i];
+	break;
+      }
+  SF_UNLOCK;
+
+  if (i == SF_CACHE)
+    {
+      if (!sf_compile (&cf, format) || cf.nops == 0)
+	return __strftime (s, maxsize, format, tim_p, locale,
+			   era_info, alt_digits);
+      SF_LOCK;
+      sf_cache[sf_cache_next++ % SF_CACHE] = cf;
+      SF_UNLOCK;
+    }
+
+  ret = sf_render (s, maxsize, &cf, tim_p, locale, era_info, alt_digits);
+  if (ret == (size_t) -1)
+    ret = __strftime (s, maxsize, format, tim_p, locale,
+		      era_info, alt_digits);
+  return ret;
+}
+
+#else /* PREFER_SIZE_OVER_SPEED || __OPTIMIZE_SIZE__ */
+#define sf_strftime	__strftime
+#endif /* PREFER_SIZE_OVER_SPEED || __OPTIMIZE_SIZE__ */
+
 size_t
 strftime (CHAR *__restrict s,
 	size_t maxsize,
@@ -1434,16 +1780,16 @@ strftime (CHAR *__restrict s,
 #ifdef _WANT_C99_TIME_FORMATS
   era_info_t *era_info = NULL;
   alt_digits_t *alt_digits = NULL;
-  size_t ret = __strftime (s, maxsize, format, tim_p, __get_current_locale (),
-			   &era_info, &alt_digits);
+  size_t ret = sf_strftime (s, maxsize, format, tim_p, __get_current_locale (),
+			    &era_info, &alt_digits);
   if (era_info)
     free_era_info (era_info);
   if (alt_digits)
     free_alt_digits (alt_digits);
   return ret;
 #else /* !_WANT_C99_TIME_FORMATS */
-  return __strftime (s, maxsize, format, tim_p, __get_current_locale (),
-		     NULL, NULL);
+  return sf_strftime (s, maxsize, format, tim_p, __get_current_locale (),
+		      NULL, NULL);
 #endif /* !_WANT_C99_TIME_FORMATS */
 }
 
@@ -1454,15 +1800,15 @@ strftime_l (CHAR *__restrict s, size_t maxsize, const CHAR *__restrict format,
 #ifdef _WANT_C99_TIME_FORMATS
   era_info_t *era_info = NULL;
   alt_digits_t *alt_digits = NULL;
-  size_t ret = __strftime (s, maxsize, format, tim_p, locale,
-			   &era_info, &alt_digits);
+  size_t ret = sf_strftime (s, maxsize, format, tim_p, locale,
+			    &era_info, &alt_digits);
   if (era_info)
     free_era_info (era_info);
   if (alt_digits)
     free_alt_digits (alt_digits);
   return ret;
 #else /* !_WANT_C99_TIME_FORMATS */
-  return __strftime (s, maxsize, format, tim_p, locale, NULL, NULL);
+  return sf_strftime (s, maxsize, format, tim_p, locale, NULL, NULL);
 #endif /* !_WANT_C99_TIME_FORMATS */
 }
 
@@ -0,0 +1,367 @@
+/*
+ * tzfile.c
+ * Support for compiled time zone information files (TZif, RFC 8536).
+ *
+ * When TZ is of the form ":Area/City" or an absolute path name, the file
+ * is read once and decoded into a table of transitions.  localtime_r and
+ * mktime then locate the offset in effect with a binary search of that
+ * table.  Times past the last transition are handled by the POSIX TZ
+ * string stored in the footer of version 2 and later files, which is
+ * handed back to _tzset_unlocked_r and parsed as usual.
+ *
+ * The zoneinfo directory defaults to TZDIR and may be overridden at run
+ * time with the TZDIR environment variable.
+ */
+
+#include <_ansi.h>
+#include <reent.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <fcntl.h>
+#include "local.h"
+
+#ifdef HAVE_TZFILE
+
+#ifndef TZDIR
+#define TZDIR		"/usr/share/zoneinfo"
+#endif
+
+/* Refuse anything larger; real zone files are a few kilobytes.  */
+#define TZFILE_MAX	(256 * 1024)
+
+#define TZ_MAGIC	"TZif"
+#define TZ_HEADER_SIZE	44
+
+struct ttinfo
+{
+  long offset;		/* seconds to add to local time to get UTC */
+  int isdst;
+  unsigned int abbr;	/* index into tzf_chars */
+};
+
+static struct
+{
+  void *block;		/* single allocation backing the arrays below */
+  int timecnt;
+  int typecnt;
+  time_t *ats;		/* transition times, ascending */
+  unsigned char *idxs;	/* type in effect from ats[i] on */
+  struct ttinfo *types;
+  char *chars;		/* time zone abbreviations */
+  int has_rule;		/* footer covers times after ats[timecnt - 1] */
+} tzf;
+
+static char tzf_footer[64];
+
+static long
+get32 (const unsigned char *p)
+{
+  return (long) (__int32_t) (((__uint32_t) p[0] << 24) | ((__uint32_t) p[1] << 16)
+			     | ((__uint32_t) p[2] << 8) | (__uint32_t) p[3]);
+}
+
+static time_t
+get64 (const unsigned char *p)
+{
+  __int64_t v = (__int64_t) (((__uint64_t) get32 (p) << 32)
+			     | (__uint32_t) get32 (p + 4));
+
+  /* Clamping keeps the table sorted when time_t is only 32 bits.  */
+  if (sizeof (time_t) < sizeof (__int64_t))
+    {
+      if (v < (__int64_t) LONG_MIN)
+	return (time_t) LONG_MIN;
+      if (v > (__int64_t) LONG_MAX)
+	return (time_t) LONG_MAX;
+    }
+  return (time_t) v;
+}
+
+void
+__tzfile_unload (struct _reent *reent_ptr)
+{
+  _free_r (reent_ptr, tzf.block);
+  memset (&tzf, 0, sizeof (tzf));
+}
+
+static unsigned char *
+read_file (struct _reent *reent_ptr, const char *name, size_t *lenp)
+{
+  char path[256];
+  const char *dir, *p;
+  unsigned char *buf = NULL, *nbuf;
+  size_t len = 0, size = 0;
+  _ssize_t n;
+  int fd;
+
+  if (*name == '/')
+    {
+      if (strlen (name) >= sizeof (path))
+	return NULL;
+      strcpy (path, name);
+    }
+  else
+    {
+      /* Do not let a relative name escape the zoneinfo directory.  */
+      for (p = name; (p = strstr (p, "..")) != NULL; p += 2)
+	if ((p == name || p[-1] == '/') && (p[2] == '/' || p[2] == '\0'))
+	  return NULL;
+      if ((dir = _getenv_r (reent_ptr, "TZDIR")) == NULL || *dir == '\0')
+	dir = TZDIR;
+      if (strlen (dir) + strlen (name) + 2 > sizeof (path))
+	return NULL;
+      strcpy (path, dir);
+      strcat (path, "/");
+      strcat (path, name);
+    }
+
+  if ((fd = _open_r (reent_ptr, path, O_RDONLY, 0)) < 0)
+    return NULL;
+
+  for (;;)
+    {
+      if (len == size)
+	{
+	  size = size ? size * 2 : 4096;
+	  if (size > TZFILE_MAX
+	      || (nbuf = _realloc_r (reent_ptr, buf, size)) == NULL)
+	    goto fail;
+	  buf = nbuf;
+	}
+      n = _read_r (reent_ptr, fd, buf + len, size - len);
+      if (n < 0)
+	goto fail;
+      if (n == 0)
+	break;
+      len += n;
+    }
+
+  _close_r (reent_ptr, fd);
+  *lenp = len;
+  return buf;
+
+fail:
+  _close_r (reent_ptr, fd);
+  _free_r (reent_ptr, buf);
+  return NULL;
+}
+
+/* Decode the data block starting at P.  TSIZE is 4 for the version 1
+   block and 8 for the version 2+ block.  Return the end of the block or
+   NULL if it does not fit within END.  */
+static const unsigned char *
+parse_block (struct _reent *reent_ptr, const unsigned char *p,
+	     const unsigned char *end, int tsize, int store)
+{
+  unsigned long isutcnt, isstdcnt, leapcnt, timecnt, typecnt, charcnt;
+  unsigned long i, need;
+  char *q;
+
+  if (end - p < TZ_HEADER_SIZE || memcmp (p, TZ_MAGIC, 4) != 0)
+    return NULL;
+  isutcnt = get32 (p + 20);
+  isstdcnt = get32 (p + 24);
+  leapcnt = get32 (p + 28);
+  timecnt = get32 (p + 32);
+  typecnt = get32 (p + 36);
+  charcnt = get32 (p + 40);
+  p += TZ_HEADER_SIZE;
+
+  if (typecnt == 0 || typecnt > 256 || timecnt > 65535 || charcnt > 1024
+      || leapcnt > 1024 || (isutcnt && isutcnt != typecnt)
+      || (isstdcnt && isstdcnt != typecnt))
+    return NULL;
+  need = timecnt * (tsize + 1) + typecnt * 6 + charcnt
+    + leapcnt * (tsize + 4) + isstdcnt + isutcnt;
+  if ((unsigned long) (end - p) < need)
+    return NULL;
+  if (!store)
+    return p + need;
+
+  tzf.block = _malloc_r (reent_ptr, timecnt * sizeof (time_t)
+			 + typecnt * sizeof (struct ttinfo)
+			 + timecnt + charcnt + 1);
+  if (tzf.block == NULL)
+    return NULL;
+  tzf.ats = (time_t *) tzf.block;
+  tzf.types = (struct ttinfo *) (tzf.ats + timecnt);
+  tzf.idxs = (unsigned char *) (tzf.types + typecnt);
+  tzf.chars = (char *) (tzf.idxs + timecnt);
+  tzf.timecnt = timecnt;
+  tzf.typecnt = typecnt;
+
+  for (i = 0; i < timecnt; ++i, p += tsize)
+    tzf.ats[i] = tsize == 4 ? (time_t) get32 (p) : get64 (p);
+  for (i = 0; i < timecnt; ++i, ++p)
+    {
+      if (*p >= typecnt
+	  || (i > 0 && tzf.ats[i] < tzf.ats[i - 1]))
+	return NULL;
+      tzf.idxs[i] = *p;
+    }
+  for (i = 0; i < typecnt; ++i, p += 6)
+    {
+      tzf.types[i].offset = -get32 (p);
+      tzf.types[i].isdst = p[4] != 0;
+      tzf.types[i].abbr = p[5];
+      if (p[5] >= charcnt)
+	return NULL;
+    }
+  memcpy (tzf.chars, p, charcnt);
+  tzf.chars[charcnt] = '\0';
+  /* Make sure every abbreviation is terminated.  */
+  for (q = tzf.chars + charcnt; q > tzf.chars && q[-1] != '\0'; --q)
+    ;
+  if (q == tzf.chars)
+    return NULL;
+  p += charcnt;
+
+  /* Leap second records and the standard/UT indicators are only of use
+     when building rules from the transition table, so skip them.  */
+  return p + leapcnt * (tsize + 4) + isstdcnt + isutcnt;
+}
+
+/* Load the zone file NAME.  On success return nonzero and set *FOOTER to
+   the POSIX TZ string that applies after the last transition, or NULL if
+   the file does not provide one, in which case _tzname, _timezone and
+   _daylight have been set from the transition table.  */
+int
+__tzfile_load_r (struct _reent *reent_ptr, const char *name, char **footer)
+{
+  unsigned char *buf;
+  const unsigned char *p, *end, *nl;
+  size_t len;
+  int i, std = -1, dst = -1;
+
+  __tzfile_unload (reent_ptr);
+  *footer = NULL;
+
+  if ((buf = read_file (reent_ptr, name, &len)) == NULL)
+    return 0;
+  end = buf + len;
+
+  if (len < TZ_HEADER_SIZE || memcmp (buf, TZ_MAGIC, 4) != 0)
+    goto fail;
+
+  if (buf[4] >= '2')
+    {
+      /* Skip the 32-bit data and use the 64-bit block that follows.  */
+      if ((p = parse_block (reent_ptr, buf, end, 4, 0)) == NULL
+	  || (p = parse_block (reent_ptr, p, end, 8, 1)) == NULL)
+	goto fail;
+      if (p < end && *p == '\n'
+	  && (nl = memchr (p + 1, '\n', end - p - 1)) != NULL
+	  && nl > p + 1 && (size_t) (nl - p - 1) < sizeof (tzf_footer))
+	{
+	  memcpy (tzf_footer, p + 1, nl - p - 1);
+	  tzf_footer[nl - p - 1] = '\0';
+	  tzf.has_rule = 1;
+	  *footer = tzf_footer;
+	}
+    }
+  else if (parse_block (reent_ptr, buf, end, 4, 1) == NULL)
+    goto fail;
+
+  _free_r (reent_ptr, buf);
+
+  if (*footer == NULL)
+    {
+      /* Name the zone after the most recent standard and daylight
+	 saving types.  */
+      for (i = tzf.timecnt - 1; i >= 0 && (std < 0 || dst < 0); --i)
+	{
+	  if (tzf.types[tzf.idxs[i]].isdst)
+	    {
+	      if (dst < 0)
+		dst = tzf.idxs[i];
+	    }
+	  else if (std < 0)
+	    std = tzf.idxs[i];
+	}
+      if (std < 0)
+	std = 0;
+      _tzname[0] = tzf.chars + tzf.types[std].abbr;
+      _tzname[1] = dst < 0 ? _tzname[0] : tzf.chars + tzf.types[dst].abbr;
+      _timezone = tzf.types[std].offset;
+      _daylight = dst >= 0;
+    }
+  return 1;
+
+fail:
+  _free_r (reent_ptr, buf);
+  __tzfile_unload (reent_ptr);
+  return 0;
+}
+
+/* Return the index of the last transition at or before TIM, -1 if TIM
+   precedes the table.  If LOCAL, TIM is a local time and each transition
+   is compared in the local time in effect just before it.  */
+static int
+find_transition (time_t tim, int local)
+{
+  int lo = 0, hi = tzf.timecnt, mid;
+  time_t at;
+
+  while (lo < hi)
+    {
+      mid = lo + (hi - lo) / 2;
+      at = tzf.ats[mid];
+      if (local)
+	at -= tzf.types[mid > 0 ? tzf.idxs[mid - 1] : 0].offset;
+      if (at <= tim)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  return lo - 1;
+}
+
+/* Look up the offset in effect at TIM (UTC).  Return zero if no zone file
+   is loaded or TIM falls in the range covered by the footer rule.  */
+int
+__tzfile_offset (time_t tim, long *offset, int *isdst)
+{
+  int i, type;
+
+  if (tzf.block == NULL)
+    return 0;
+  i = find_transition (tim, 0);
+  if (i == tzf.timecnt - 1 && tzf.has_rule)
+    return 0;
+  type = i < 0 ? 0 : tzf.idxs[i];
+  *offset = tzf.types[type].offset;
+  *isdst = tzf.types[type].isdst;
+  return 1;
+}
+
+/* Like __tzfile_offset, but TIM is a local time as passed to mktime.
+   When ISDST_HINT is not negative and disagrees with the type found, the
+   neighbouring type with the requested DST flag is used instead, which
+   resolves ambiguous times at the end of daylight saving time.  */
+int
+__tzfile_local_offset (time_t tim, int isdst_hint, long *offset, int *isdst)
+{
+  int i, type, alt;
+
+  if (tzf.block == NULL)
+    return 0;
+  i = find_transition (tim, 1);
+  if (tzf.has_rule && i >= tzf.timecnt - 1)
+    return 0;
+  type = i < 0 ? 0 : tzf.idxs[i];
+  if (isdst_hint >= 0 && tzf.types[type].isdst != isdst_hint)
+    {
+      alt = i > 0 ? tzf.idxs[i - 1] : 0;
+      if (i >= 0 && tzf.types[alt].isdst == isdst_hint)
+	type = alt;
+      else if (i + 1 < tzf.timecnt
+	       && tzf.types[tzf.idxs[i + 1]].isdst == isdst_hint)
+	type = tzf.idxs[i + 1];
+    }
+  *offset = tzf.types[type].offset;
+  *isdst = tzf.types[type].isdst;
+  return 1;
+}
+
+#endif /* HAVE_TZFILE */
@@ -44,6 +44,15 @@ Note that there is no white-space padding between fields.  Also note that
 if TZ is null, the default is Universal GMT which has no daylight-savings
 time.  If TZ is empty, the default EST5EDT is used.
 
+On systems built with HAVE_TZFILE, a TZ value of the form :<[file]> or
+an absolute path name selects a compiled time zone information (TZif)
+file.  A relative <[file]> is looked up in the directory named by the
+TZDIR environment variable, or <</usr/share/zoneinfo>> if TZDIR is not
+set.  The file is read once per TZ setting; its transition table gives
+the historical offsets and the POSIX rule stored at its end, if any, is
+used for times after the last transition.  If the file cannot be loaded
+the remainder of TZ is parsed as the POSIX format above.
+
 The function <<_tzset_r>> is identical to <<tzset>> only it is reentrant
 and is used for applications that use multiple threads.
 
@@ -53,7 +62,8 @@ There is no return value.
 PORTABILITY
 <<tzset>> is part of the POSIX standard.
 
-Supporting OS subroutine required: None
+Supporting OS subroutines required: None, or <<open>>, <<read>> and
+<<close>> when TZif files are supported.
 */
 
 #include <_ansi.h>
@@ -13,6 +13,22 @@ static char __tzname_std[11];
 static char __tzname_dst[11];
 static char *prev_tzenv = NULL;
 
+/* Scan a zone name into NAME, which holds 11 characters.  Besides the
+   alphabetic form this accepts the quoted "<+03>" form used by zone file
+   footers.  */
+static int
+parse_name (const char *tzenv, char *name, int *n)
+{
+  if (*tzenv == '<')
+    {
+      *n = 0;
+      if (sscanf (tzenv, "<%10[^>]>%n", name, n) <= 0 || *n == 0)
+	return 0;
+      return 1;
+    }
+  return sscanf (tzenv, "%10[^0-9,+-]%n", name, n);
+}
+
 void
 _tzset_unlocked_r (struct _reent *reent_ptr)
 {
@@ -30,6 +46,9 @@ _tzset_unlocked_r (struct _reent *reent_ptr)
 	_tzname[1] = "GMT";
 	free(prev_tzenv);
 	prev_tzenv = NULL;
+#ifdef HAVE_TZFILE
+	__tzfile_unload (reent_ptr);
+#endif
 	return;
       }
 
@@ -41,11 +60,29 @@ _tzset_unlocked_r (struct _reent *reent_ptr)
   if (prev_tzenv != NULL)
     strcpy (prev_tzenv, tzenv);
 
+#ifdef HAVE_TZFILE
+  /* ":Area/City" or an absolute path names a compiled zone file.  If it
+     loads, only its footer rule, if any, remains to be parsed.  */
+  if (*tzenv == ':' || *tzenv == '/')
+    {
+      char *footer;
+
+      if (__tzfile_load_r (reent_ptr, tzenv + (*tzenv == ':'), &footer))
+	{
+	  if (footer == NULL)
+	    return;
+	  tzenv = footer;
+	}
+    }
+  else
+    __tzfile_unload (reent_ptr);
+#endif
+
   /* ignore implementation-specific format specifier */
   if (*tzenv == ':')
     ++tzenv;  
 
-  if (sscanf (tzenv, "%10[^0-9,+-]%n", __tzname_std, &n) <= 0)
+  if (parse_name (tzenv, __tzname_std, &n) <= 0)
     return;
  
   tzenv += n;
@@ -69,7 +106,7 @@ _tzset_unlocked_r (struct _reent *reent_ptr)
   _tzname[0] = __tzname_std;
   tzenv += n;
   
-  if (sscanf (tzenv, "%10[^0-9,+-]%n", __tzname_dst, &n) <= 0)
+  if (parse_name (tzenv, __tzname_dst, &n) <= 0)
     { /* No dst */
       _tzname[1] = _tzname[0];
       _timezone = tz->__tzrule[0].offset;
@@ -36,6 +36,7 @@
  * xdr.
  */
 
+#include <limits.h>
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
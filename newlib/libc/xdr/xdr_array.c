@@ -46,6 +46,136 @@
 
 #include "xdr_private.h"
 
+#if !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+/*
+ * Arrays of primitives whose encoding is just their bits in big endian
+ * 32-bit words are converted straight from or to the stream's buffer,
+ * XDR_BULK_BYTES at a time.
+ */
+#define XDR_BULK
+#define XDR_BULK_BYTES 512
+
+/*
+ * Return the number of 32-bit words in the encoding of one element if
+ * elproc is such a primitive for elements of elsize bytes, else 0.
+ */
+static u_int
+xdr_bulk_words (xdrproc_t elproc,
+	u_int elsize)
+{
+  if (elsize == 4
+      && (elproc == (xdrproc_t) xdr_int
+          || elproc == (xdrproc_t) xdr_u_int
+          || elproc == (xdrproc_t) xdr_int32_t
+          || elproc == (xdrproc_t) xdr_u_int32_t
+          || elproc == (xdrproc_t) xdr_uint32_t
+#if defined(__IEEE_LITTLE_ENDIAN) || defined(__IEEE_BIG_ENDIAN)
+          || elproc == (xdrproc_t) xdr_float
+#endif
+         ))
+    return 1;
+  if (elsize == 8
+      && (elproc == (xdrproc_t) xdr_int64_t
+          || elproc == (xdrproc_t) xdr_u_int64_t
+          || elproc == (xdrproc_t) xdr_uint64_t
+          || elproc == (xdrproc_t) xdr_hyper
+          || elproc == (xdrproc_t) xdr_u_hyper
+          || elproc == (xdrproc_t) xdr_longlong_t
+          || elproc == (xdrproc_t) xdr_u_longlong_t
+#if !defined(_DOUBLE_IS_32BITS) \
+    && ((defined(__IEEE_LITTLE_ENDIAN) && BYTE_ORDER == LITTLE_ENDIAN) \
+        || (defined(__IEEE_BIG_ENDIAN) && BYTE_ORDER == BIG_ENDIAN))
+          || elproc == (xdrproc_t) xdr_double
+#endif
+         ))
+    return 2;
+  return 0;
+}
+
+/*
+ * Copy n elements of the given number of words between the native array
+ * at src and the encoding at dst, or the other way round.
+ */
+static void
+xdr_bulk_copy (uint32_t *dst,
+	const uint32_t *src,
+	u_int n,
+	u_int words)
+{
+  u_int i;
+
+  n *= words;
+#if BYTE_ORDER == BIG_ENDIAN
+  memcpy (dst, src, n * sizeof (uint32_t));
+#else
+  if (words == 2)
+    for (i = 0; i < n; i += 2)
+      {
+        uint32_t lo = src[i];
+
+        dst[i] = xdr_ntohl (src[i + 1]);
+        dst[i + 1] = xdr_ntohl (lo);
+      }
+  else
+    for (i = 0; i < n; i++)
+      dst[i] = xdr_ntohl (src[i]);
+#endif
+}
+#endif /* !PREFER_SIZE_OVER_SPEED && !__OPTIMIZE_SIZE__ */
+
+/*
+ * XDR nelem elements of elsize bytes each at basep with elproc.
+ */
+static bool_t
+xdr_elements (XDR * xdrs,
+	char *basep,
+	u_int nelem,
+	u_int elsize,
+	xdrproc_t elproc)
+{
+  u_int i;
+#ifdef XDR_BULK
+  u_int n, words;
+  int32_t *buf;
+
+  words = xdr_bulk_words (elproc, elsize);
+  if (words != 0 && xdrs->x_op == XDR_FREE)
+    return TRUE;
+  if (words != 0 && xdrs->x_ops->x_inline != NULL)
+    {
+      while (nelem > 0)
+        {
+          n = MIN (nelem, XDR_BULK_BYTES / elsize);
+          buf = XDR_INLINE (xdrs, n * elsize);
+          if (buf == NULL)
+            {
+              /* e.g. at the end of a record buffer */
+              for (i = 0; i < n; i++)
+                if (!(*elproc) (xdrs, basep + i * elsize))
+                  return FALSE;
+            }
+          else if (xdrs->x_op == XDR_ENCODE)
+            xdr_bulk_copy ((uint32_t *) buf, (uint32_t *) basep, n, words);
+          else
+            xdr_bulk_copy ((uint32_t *) basep, (uint32_t *) buf, n, words);
+          basep += n * elsize;
+          nelem -= n;
+        }
+      return TRUE;
+    }
+#endif
+
+  for (i = 0; i < nelem; i++)
+    {
+      if (!(*elproc) (xdrs, basep))
+        {
+          return FALSE;
+        }
+      basep += elsize;
+    }
+  return TRUE;
+}
+
 /*
  * XDR an array of arbitrary elements
  * *addrp is a pointer to the array, *sizep is the number of elements.
@@ -61,7 +191,6 @@ xdr_array (XDR * xdrs,
         u_int elsize,
 	xdrproc_t elproc)
 {
-  u_int i;
   caddr_t target = *addrp;
   u_int c;                      /* the actual element count */
   bool_t stat = TRUE;
@@ -109,11 +238,7 @@ xdr_array (XDR * xdrs,
   /*
    * now we xdr each element of array
    */
-  for (i = 0; (i < c) && stat; i++)
-    {
-      stat = (*elproc) (xdrs, target);
-      target += elsize;
-    }
+  stat = xdr_elements (xdrs, target, c, elsize, elproc);
 
   /*
    * the array may need freeing
@@ -143,17 +268,5 @@ xdr_vector (XDR * xdrs,
 	u_int elemsize,
         xdrproc_t xdr_elem)
 {
-  u_int i;
-  char *elptr;
-
-  elptr = basep;
-  for (i = 0; i < nelem; i++)
-    {
-      if (!(*xdr_elem) (xdrs, elptr))
-        {
-          return FALSE;
-        }
-      elptr += elemsize;
-    }
-  return TRUE;
+  return xdr_elements (xdrs, basep, nelem, elemsize, xdr_elem);
 }
@@ -111,6 +111,15 @@ static const struct xdr_ops xdrrec_ops = {
 
 #define LAST_FRAG ((u_int32_t)(UINT32_C(1) << 31))
 
+#if !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+/*
+ * Byte runs at least as large as the stream buffer bypass it: they are
+ * written right after the buffered part of their fragment, and read
+ * straight into the caller's memory.
+ */
+#define XDRREC_DIRECT
+#endif
+
 typedef struct rec_strm
 {
   caddr_t tcp_handle;
@@ -150,6 +159,9 @@ typedef struct rec_strm
 
 static u_int fix_buf_size (u_int);
 static bool_t flush_out (RECSTREAM *, bool_t);
+#ifdef XDRREC_DIRECT
+static bool_t flush_out_direct (RECSTREAM *, const char *, u_int);
+#endif
 static bool_t fill_input_buf (RECSTREAM *);
 static bool_t get_input_bytes (RECSTREAM *, char *, size_t);
 static bool_t set_input_fragment (RECSTREAM *);
@@ -346,6 +358,13 @@ xdrrec_putbytes (XDR * xdrs,
   RECSTREAM *rstrm = (RECSTREAM *) (xdrs->x_private);
   size_t current;
 
+#ifdef XDRREC_DIRECT
+  if (len >= rstrm->sendsize && len <= INT_MAX - rstrm->sendsize)
+    {
+      rstrm->frag_sent = TRUE;
+      return flush_out_direct (rstrm, addr, len);
+    }
+#endif
   while (len > 0)
     {
       current = (size_t) ((u_long) rstrm->out_boundry -
@@ -757,6 +776,36 @@ flush_out (RECSTREAM * rstrm,
   return TRUE;
 }
 
+#ifdef XDRREC_DIRECT
+/*
+ * Like flush_out (rstrm, FALSE), but the fragment goes on with the len
+ * bytes at addr, which are written from there instead of being copied
+ * into the buffer first.
+ */
+static bool_t
+flush_out_direct (RECSTREAM * rstrm,
+	const char *addr,
+	u_int len)
+{
+  u_int32_t buffered = (u_int32_t) ((u_long) (rstrm->out_finger) -
+                                    (u_long) (rstrm->frag_header) -
+                                    sizeof (u_int32_t));
+
+  *(rstrm->frag_header) = htonl (buffered + len);
+  buffered = (u_int32_t) ((u_long) (rstrm->out_finger) -
+                          (u_long) (rstrm->out_base));
+  if ((*(rstrm->writeit)) (rstrm->tcp_handle, rstrm->out_base, (int) buffered)
+      != (int) buffered)
+    return FALSE;
+  rstrm->frag_header = (u_int32_t *) (void *) rstrm->out_base;
+  rstrm->out_finger = (char *) rstrm->out_base + sizeof (u_int32_t);
+  if ((*(rstrm->writeit)) (rstrm->tcp_handle, (void *) addr, (int) len)
+      != (int) len)
+    return FALSE;
+  return TRUE;
+}
+#endif
+
 static bool_t                   /* knows nothing about records!  Only about input buffers */
 fill_input_buf (RECSTREAM * rstrm)
 {
@@ -799,6 +848,22 @@ get_input_bytes (RECSTREAM * rstrm,
   while (len > 0)
     {
       current = (size_t) ((long) rstrm->in_boundry - (long) rstrm->in_finger);
+#ifdef XDRREC_DIRECT
+      if (current == 0 && len >= rstrm->in_size)
+        {
+          int n;
+
+          /* read into place, keeping the buffer's alignment to the stream */
+          if ((n = (*(rstrm->readit)) (rstrm->tcp_handle, addr,
+                                       (int) MIN (len, INT_MAX))) == -1)
+            return FALSE;
+          rstrm->in_finger = rstrm->in_boundry = rstrm->in_base +
+            ((u_long) (rstrm->in_boundry + n) % BYTES_PER_XDR_UNIT);
+          addr += n;
+          len -= n;
+          continue;
+        }
+#endif
       if (current == 0)
         {
           if (!fill_input_buf (rstrm))
@@ -0,0 +1,129 @@
+/*
+ * Round trip days through gmtime_r and timegm: every day of the years
+ * around the ends of the range of time_t (bounded to roughly years -1900
+ * to 6000), the epoch and the leap year rule's exceptions, and a sample
+ * of the rest.  Check that mktime in UTC and timegm normalize
+ * out-of-range fields alike.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "check.h"
+
+#define SECSPERDAY 86400L
+
+static void
+check_round_trip (time_t t)
+{
+  struct tm tm, tm2;
+
+  CHECK (gmtime_r (&t, &tm) != NULL);
+  tm2 = tm;
+  CHECK (timegm (&tm2) == t);
+  CHECK (memcmp (&tm, &tm2, sizeof (tm)) == 0);
+}
+
+/* ndays days from t, at a time of day that walks through the whole day.  */
+static void
+check_days (time_t t, long ndays)
+{
+  long i;
+
+  for (i = 0; i < ndays; ++i)
+    check_round_trip (t + (time_t) i * SECSPERDAY + (i * 7919) % SECSPERDAY);
+}
+
+static long
+floor_div (long a, long b)
+{
+  return a / b - (a % b < 0);
+}
+
+/* Days from 1970-01-01 to January 1 of year y.  */
+static long
+jan1 (long y)
+{
+  return 365 * (y - 1970) + floor_div (y + 3, 4) - floor_div (y + 99, 100)
+	 + floor_div (y + 399, 400) - 478;
+}
+
+static const long years[] = {
+  -400, -1, 0, 1600, 1900, 1970, 2000, 2038, 2100, 2400
+};
+
+int
+main (void)
+{
+  time_t t, lo, hi;
+  struct tm tm, tm2;
+  long i, d;
+
+  if (sizeof (time_t) > 4)
+    {
+      lo = (time_t) -3870L * 365 * SECSPERDAY;	/* around year -1900 */
+      hi = (time_t) 4030L * 365 * SECSPERDAY;	/* around year 6000 */
+    }
+  else
+    {
+      lo = (time_t) -0x7fffffffL;
+      hi = (time_t) 0x7fffffffL - SECSPERDAY;
+    }
+
+  /* Every day of the years at the ends of the range and around the
+     others of interest that time_t can hold.  */
+  check_days (lo, 800);
+  check_days (hi - 800 * SECSPERDAY, 800);
+  for (i = 0; i < (long) (sizeof (years) / sizeof (years[0])); ++i)
+    {
+      d = jan1 (years[i]);
+      if (d - 400 < lo / SECSPERDAY || d + 400 > hi / SECSPERDAY)
+	continue;
+      t = (time_t) d * SECSPERDAY;
+      CHECK (gmtime_r (&t, &tm) != NULL);
+      CHECK (tm.tm_year == years[i] - 1900 && tm.tm_mon == 0
+	     && tm.tm_mday == 1 && tm.tm_yday == 0);
+      check_days (t - 400 * SECSPERDAY, 800);
+    }
+
+  /* A sample of the rest; the stride is prime, so it meets every
+     position in the leap year cycles.  */
+  for (t = lo; t < hi - 997 * SECSPERDAY; t += 997 * SECSPERDAY + 7919)
+    check_round_trip (t);
+  check_round_trip (0);
+  check_round_trip (hi);
+
+  /* Normalization of out-of-range fields.  */
+  memset (&tm, 0, sizeof (tm));
+  tm.tm_year = 70;
+  tm.tm_mon = -13;
+  tm.tm_mday = 10000;
+  tm.tm_hour = -49;
+  tm.tm_min = 3000;
+  tm.tm_sec = -70;
+  tm2 = tm;
+  t = timegm (&tm);
+  CHECK (t == (time_t) ((-396L + 9999) * SECSPERDAY - 49 * 3600L
+			+ 3000 * 60L - 70));
+  CHECK (tm.tm_year == 96 && tm.tm_mon == 3 && tm.tm_mday == 17);
+  CHECK (tm.tm_hour == 0 && tm.tm_min == 58 && tm.tm_sec == 50);
+  CHECK (tm.tm_yday == 107 && tm.tm_wday == 3 && tm.tm_isdst == 0);
+
+  setenv ("TZ", "UTC0", 1);
+  tzset ();
+  tm2.tm_isdst = 0;
+  CHECK (mktime (&tm2) == t);
+  CHECK (memcmp (&tm, &tm2, sizeof (tm)) == 0);
+
+  for (i = -1000000; i <= 1000000; i += 997)
+    {
+      memset (&tm, 0, sizeof (tm));
+      tm.tm_year = 100;
+      tm.tm_mon = 1;
+      tm.tm_mday = i;
+      tm2 = tm;
+      CHECK (timegm (&tm) == (time_t) (10987L + i) * SECSPERDAY);
+      CHECK (mktime (&tm2) == timegm (&tm));
+    }
+
+  exit (0);
+}